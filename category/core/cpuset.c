@@ -15,11 +15,30 @@
 
 #include <category/core/cpuset.h>
 
+#include <ctype.h>
+#include <errno.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include <sched.h>
 
+static int parse_cpu(char const **const s, unsigned *const cpu)
+{
+    // strtol would also take leading spaces and a sign
+    if (!isdigit((unsigned char)**s)) {
+        return EINVAL;
+    }
+    char *end;
+    errno = 0;
+    long const n = strtol(*s, &end, 10);
+    if (errno != 0 || n >= CPU_SETSIZE) {
+        return EINVAL;
+    }
+    *cpu = (unsigned)n;
+    *s = end;
+    return 0;
+}
+
 cpu_set_t monad_parse_cpuset(char *const s)
 {
     cpu_set_t set;
@@ -52,3 +71,32 @@ cpu_set_t monad_parse_cpuset(char *const s)
 
     return set;
 }
+
+int monad_try_parse_cpuset(char const *s, cpu_set_t *const set)
+{
+    CPU_ZERO(set);
+    for (;;) {
+        unsigned first;
+        unsigned last;
+        if (parse_cpu(&s, &first) != 0) {
+            return EINVAL;
+        }
+        last = first;
+        if (*s == '-') {
+            ++s;
+            if (parse_cpu(&s, &last) != 0 || last < first) {
+                return EINVAL;
+            }
+        }
+        for (unsigned i = first; i <= last; ++i) {
+            CPU_SET(i, set);
+        }
+        if (*s == '\0') {
+            return 0;
+        }
+        if (*s != ',') {
+            return EINVAL;
+        }
+        ++s;
+    }
+}
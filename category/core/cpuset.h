@@ -24,6 +24,11 @@ extern "C"
 
 cpu_set_t monad_parse_cpuset(char *);
 
+/// Parses a cpu list such as "0-3,8" into `set`. Returns 0, or EINVAL if
+/// the list is malformed, a range is reversed or a cpu is not below
+/// CPU_SETSIZE. A valid list is never empty.
+int monad_try_parse_cpuset(char const *, cpu_set_t *set);
+
 #ifdef __cplusplus
 }
 #endif
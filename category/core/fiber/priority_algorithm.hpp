@@ -37,13 +37,16 @@ class PriorityAlgorithm final
     bool prevent_spin_{false};
 
     PriorityQueue &rqueue_;
+    // shard of the ready queue owned by this thread
+    unsigned const shard_;
 
     using lqueue_type = boost::fibers::scheduler::ready_queue_type;
 
     lqueue_type lqueue_{};
 
 public:
-    explicit PriorityAlgorithm(PriorityQueue &, bool prevent_spin = false);
+    explicit PriorityAlgorithm(
+        PriorityQueue &, unsigned shard = 0, bool prevent_spin = false);
 
     PriorityAlgorithm(PriorityAlgorithm const &) = delete;
     PriorityAlgorithm(PriorityAlgorithm &&) = delete;
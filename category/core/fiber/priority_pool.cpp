@@ -29,29 +29,67 @@
 #include <boost/fiber/protected_fixedsize_stack.hpp>
 
 #include <cstdio>
+#include <cstring>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <thread>
 #include <utility>
 
 #include <pthread.h>
+#include <sched.h>
 
 MONAD_FIBER_NAMESPACE_BEGIN
 
+namespace
+{
+    void pin_thread(unsigned const i, std::optional<cpu_set_t> const &cpus)
+    {
+        if (!cpus.has_value()) {
+            return;
+        }
+        int const n_cpus = CPU_COUNT(&*cpus);
+        MONAD_ASSERT(n_cpus > 0);
+        int n = static_cast<int>(i % static_cast<unsigned>(n_cpus));
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &*cpus) && n-- == 0) {
+                cpu_set_t set;
+                CPU_ZERO(&set);
+                CPU_SET(cpu, &set);
+                // e.g. a cpu outside the cpuset of the process, the thread
+                // keeps running unpinned
+                if (int const err = pthread_setaffinity_np(
+                        pthread_self(), sizeof(cpu_set_t), &set)) {
+                    std::fprintf(
+                        stderr,
+                        "worker %u: could not pin to cpu %d: %s\n",
+                        i,
+                        cpu,
+                        std::strerror(err));
+                }
+                return;
+            }
+        }
+    }
+}
+
 PriorityPool::PriorityPool(
-    unsigned const n_threads, unsigned const n_fibers, bool const prevent_spin)
+    unsigned const n_threads, unsigned const n_fibers, bool const prevent_spin,
+    std::optional<cpu_set_t> const &cpus)
+    : queue_{n_threads}
 {
     MONAD_ASSERT(n_threads);
     MONAD_ASSERT(n_fibers);
 
     threads_.reserve(n_threads);
     for (unsigned i = n_threads - 1; i > 0; --i) {
-        auto thread = std::thread([this, i, prevent_spin] {
+        auto thread = std::thread([this, i, prevent_spin, cpus] {
             char name[16];
             std::snprintf(name, 16, "worker %u", i);
             pthread_setname_np(pthread_self(), name);
+            pin_thread(i, cpus);
             boost::fibers::use_scheduling_algorithm<PriorityAlgorithm>(
-                queue_, prevent_spin);
+                queue_, i, prevent_spin);
             std::unique_lock<boost::fibers::mutex> lock{mutex_};
             cv_.wait(lock, [this] { return done_; });
         });
@@ -59,10 +97,11 @@ PriorityPool::PriorityPool(
     }
 
     fibers_.reserve(n_fibers);
-    auto thread = std::thread([this, n_fibers, prevent_spin] {
+    auto thread = std::thread([this, n_fibers, prevent_spin, cpus] {
         pthread_setname_np(pthread_self(), "worker 0");
+        pin_thread(0, cpus);
         boost::fibers::use_scheduling_algorithm<PriorityAlgorithm>(
-            queue_, prevent_spin);
+            queue_, 0u, prevent_spin);
         for (unsigned i = 0; i < n_fibers; ++i) {
             auto *const properties = new PriorityProperties{nullptr};
             boost::fibers::fiber fiber{
@@ -24,14 +24,20 @@
 #include <boost/fiber/mutex.hpp>
 
 #include <future>
+#include <optional>
 #include <thread>
 #include <utility>
 
+#include <sched.h>
+
 MONAD_FIBER_NAMESPACE_BEGIN
 
+// Fibers are scheduled through a ready queue sharded per thread, see
+// PriorityQueue. Tasks are started in submission order; once started, a task
+// runs on whichever thread picks it, preferring the thread that woke it.
 class PriorityPool final
 {
-    PriorityQueue queue_{};
+    PriorityQueue queue_;
 
     bool done_{false};
 
@@ -47,8 +53,12 @@ class PriorityPool final
     std::promise<void> start_{};
 
 public:
+    // if `cpus` is set, thread i is pinned to the i-th cpu of the set, modulo
+    // its size, so that a set of cpus of one NUMA node keeps the pool and
+    // its memory on that node
     PriorityPool(
-        unsigned n_threads, unsigned n_fibers, bool prevent_spin = false);
+        unsigned n_threads, unsigned n_fibers, bool prevent_spin = false,
+        std::optional<cpu_set_t> const &cpus = std::nullopt);
 
     PriorityPool(PriorityPool const &) = delete;
     PriorityPool &operator=(PriorityPool const &) = delete;
@@ -15,25 +15,93 @@
 
 #include <category/core/fiber/priority_queue.hpp>
 
+#include <category/core/assert.h>
 #include <category/core/fiber/config.hpp>
+#include <category/core/likely.h>
+
+#include <boost/fiber/context.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 
 MONAD_FIBER_NAMESPACE_BEGIN
 
-bool PriorityQueue::empty() const
+PriorityQueue::PriorityQueue(unsigned const n_shards)
+    : n_shards_{n_shards}
+    , shards_{std::make_unique<Shard[]>(n_shards)}
 {
-    return queue_.empty();
+    MONAD_ASSERT(n_shards);
 }
 
-context *PriorityQueue::pop()
+context *PriorityQueue::try_pop(Shard &shard)
 {
-    context *ctx = nullptr;
-    queue_.try_pop(ctx);
+    if (shard.top.load(std::memory_order_acquire) == EMPTY) {
+        return nullptr;
+    }
+    std::unique_lock const lock{shard.lock};
+    if (MONAD_UNLIKELY(shard.heap.empty())) {
+        return nullptr;
+    }
+    std::pop_heap(shard.heap.begin(), shard.heap.end(), Compare{});
+    context *const ctx = shard.heap.back();
+    shard.heap.pop_back();
+    shard.top.store(
+        shard.heap.empty() ? EMPTY : Compare::get_priority(shard.heap.front()),
+        std::memory_order_release);
     return ctx;
 }
 
-void PriorityQueue::push(context *const ctx)
+bool PriorityQueue::empty() const
+{
+    for (unsigned i = 0; i < n_shards_; ++i) {
+        if (shards_[i].top.load(std::memory_order_acquire) != EMPTY) {
+            return false;
+        }
+    }
+    return true;
+}
+
+context *PriorityQueue::pop(unsigned const shard)
+{
+    MONAD_ASSERT(shard < n_shards_);
+    Shard &own = shards_[shard];
+    if (n_shards_ > 1) {
+        // priority-aware stealing: compare with one victim per pop, picked
+        // round robin so that every shard is looked at
+        static thread_local unsigned next = 0;
+        unsigned const victim =
+            (shard + 1 + next++ % (n_shards_ - 1)) % n_shards_;
+        Shard &other = shards_[victim];
+        if (other.top.load(std::memory_order_acquire) <
+            own.top.load(std::memory_order_acquire)) {
+            if (context *const ctx = try_pop(other)) {
+                return ctx;
+            }
+        }
+    }
+    if (context *const ctx = try_pop(own)) {
+        return ctx;
+    }
+    for (unsigned i = 1; i < n_shards_; ++i) {
+        if (context *const ctx = try_pop(shards_[(shard + i) % n_shards_])) {
+            return ctx;
+        }
+    }
+    return nullptr;
+}
+
+void PriorityQueue::push(unsigned const shard, context *const ctx)
 {
-    queue_.push(ctx);
+    MONAD_ASSERT(shard < n_shards_);
+    Shard &own = shards_[shard];
+    std::unique_lock const lock{own.lock};
+    own.heap.push_back(ctx);
+    std::push_heap(own.heap.begin(), own.heap.end(), Compare{});
+    own.top.store(
+        Compare::get_priority(own.heap.front()), std::memory_order_release);
 }
 
 MONAD_FIBER_NAMESPACE_END
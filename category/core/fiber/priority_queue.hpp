@@ -20,14 +20,25 @@
 #include <category/core/fiber/priority_properties.hpp>
 #include <category/core/likely.h>
 
+#include <category/core/synchronization/spin_lock.hpp>
+
 #include <boost/fiber/context.hpp>
 
-#include <oneapi/tbb/concurrent_priority_queue.h>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
 
 MONAD_FIBER_NAMESPACE_BEGIN
 
 using boost::fibers::context;
 
+// Ready queue shared by the threads of a pool, sharded per thread. A thread
+// pushes the fibers it wakes to its own shard and pops the most urgent of
+// its own shard and of one other shard, so it works locally while no other
+// shard has a more urgent fiber, and steals otherwise. When both are empty
+// it steals from any shard.
 class PriorityQueue final
 {
     struct Compare
@@ -47,14 +58,34 @@ class PriorityQueue final
         }
     };
 
-    oneapi::tbb::concurrent_priority_queue<context *, Compare> queue_;
+    static constexpr uint64_t EMPTY = std::numeric_limits<uint64_t>::max();
+
+    struct alignas(64) Shard
+    {
+        SpinLock lock{};
+        std::vector<context *> heap{};
+        // priority of the front of the heap, read without the lock
+        std::atomic<uint64_t> top{EMPTY};
+    };
+
+    unsigned const n_shards_;
+    std::unique_ptr<Shard[]> shards_;
+
+    context *try_pop(Shard &);
 
 public:
+    explicit PriorityQueue(unsigned n_shards = 1);
+
+    unsigned num_shards() const
+    {
+        return n_shards_;
+    }
+
     bool empty() const;
 
-    context *pop();
+    context *pop(unsigned shard);
 
-    void push(context *);
+    void push(unsigned shard, context *);
 };
 
 MONAD_FIBER_NAMESPACE_END
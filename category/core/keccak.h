@@ -26,6 +26,17 @@ void keccak256(
     unsigned char const *in, unsigned long len,
     unsigned char out[KECCAK256_SIZE]);
 
+// keccak256 of 4 (8) messages of the same length, with the same results as
+// hashing each of them alone. The states are permuted side by side in the
+// lanes of AVX2 registers, or AVX-512 registers when built for AVX-512.
+void keccak256_x4(
+    unsigned char const *const in[4], unsigned long len,
+    unsigned char *const out[4]);
+
+void keccak256_x8(
+    unsigned char const *const in[8], unsigned long len,
+    unsigned char *const out[8]);
+
 #ifdef __cplusplus
 }
 #endif
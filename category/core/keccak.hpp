@@ -15,14 +15,20 @@
 
 #pragma once
 
+#include <category/core/assert.h>
 #include <category/core/byte_string.hpp>
 #include <category/core/keccak.h>
 
 #include <ethash/hash_types.hpp>
 
+#include <cstddef>
+#include <span>
+
 MONAD_NAMESPACE_BEGIN
 
 using ::keccak256;
+using ::keccak256_x4;
+using ::keccak256_x8;
 
 using hash256 = ethash::hash256;
 
@@ -39,4 +45,46 @@ inline hash256 keccak256(unsigned char const (&a)[N])
     return keccak256(to_byte_string_view(a));
 }
 
+// hashes in[i] into out[i], runs of messages of the same length are hashed
+// several at a time
+inline void keccak256(
+    std::span<byte_string_view const> const in, std::span<hash256> const out)
+{
+    MONAD_ASSERT(in.size() == out.size());
+    auto const same_length = [&](size_t const i, size_t const n) {
+        if (i + n > in.size()) {
+            return false;
+        }
+        for (size_t j = i + 1; j < i + n; ++j) {
+            if (in[j].size() != in[i].size()) {
+                return false;
+            }
+        }
+        return true;
+    };
+    size_t i = 0;
+    while (i < in.size()) {
+        size_t const n =
+            same_length(i, 8) ? 8 : (same_length(i, 4) ? 4 : 1);
+        if (n == 1) {
+            out[i] = keccak256(in[i]);
+            ++i;
+            continue;
+        }
+        unsigned char const *src[8];
+        unsigned char *dst[8];
+        for (size_t j = 0; j < n; ++j) {
+            src[j] = in[i + j].data();
+            dst[j] = out[i + j].bytes;
+        }
+        if (n == 8) {
+            keccak256_x8(src, in[i].size(), dst);
+        }
+        else {
+            keccak256_x4(src, in[i].size(), dst);
+        }
+        i += n;
+    }
+}
+
 MONAD_NAMESPACE_END
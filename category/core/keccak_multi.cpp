@@ -0,0 +1,168 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/core/keccak.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+    constexpr size_t BLOCK_SIZE = (1600 - 2 * 256) / 8;
+    constexpr size_t BLOCK_WORDS = BLOCK_SIZE / sizeof(uint64_t);
+
+    constexpr uint64_t ROUND_CONSTANTS[24] = {
+        0x0000000000000001, 0x0000000000008082, 0x800000000000808a,
+        0x8000000080008000, 0x000000000000808b, 0x0000000080000001,
+        0x8000000080008081, 0x8000000000008009, 0x000000000000008a,
+        0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+        0x000000008000808b, 0x800000000000008b, 0x8000000000008089,
+        0x8000000000008003, 0x8000000000008002, 0x8000000000000080,
+        0x000000000000800a, 0x800000008000000a, 0x8000000080008081,
+        0x8000000000008080, 0x0000000080000001, 0x8000000080008008};
+
+    // rho offsets and pi destinations, following the lane at index 1
+    constexpr unsigned RHO[24] = {1,  3,  6,  10, 15, 21, 28, 36,
+                                  45, 55, 2,  14, 27, 41, 56, 8,
+                                  25, 43, 62, 18, 39, 61, 20, 44};
+    constexpr unsigned PI[24] = {10, 7,  11, 17, 18, 3, 5,  16,
+                                 8,  21, 24, 4,  15, 23, 19, 13,
+                                 12, 2,  20, 14, 22, 9,  6,  1};
+
+    // element i of every lane belongs to message i
+    using Lanes4 = uint64_t __attribute__((vector_size(32)));
+    using Lanes8 = uint64_t __attribute__((vector_size(64)));
+
+    // Keccak-f[1600] on one state per vector element, A[x + 5 * y] is lane
+    // (x, y) of every state. The loops are unrolled, so that lane indices
+    // and rotations are constants.
+    template <class V>
+    void keccak_f1600(V *const A)
+    {
+        for (unsigned round = 0; round < 24; ++round) {
+            // theta
+            V C[5];
+#pragma GCC unroll 5
+            for (unsigned x = 0; x < 5; ++x) {
+                C[x] = A[x] ^ A[x + 5] ^ A[x + 10] ^ A[x + 15] ^ A[x + 20];
+            }
+#pragma GCC unroll 5
+            for (unsigned x = 0; x < 5; ++x) {
+                V const &next = C[(x + 1) % 5];
+                V const D = C[(x + 4) % 5] ^ ((next << 1) | (next >> 63));
+#pragma GCC unroll 5
+                for (unsigned y = 0; y < 25; y += 5) {
+                    A[x + y] ^= D;
+                }
+            }
+            // rho and pi
+            V moved = A[1];
+#pragma GCC unroll 24
+            for (unsigned i = 0; i < 24; ++i) {
+                V const next = A[PI[i]];
+                A[PI[i]] = (moved << RHO[i]) | (moved >> (64 - RHO[i]));
+                moved = next;
+            }
+            // chi
+#pragma GCC unroll 5
+            for (unsigned y = 0; y < 25; y += 5) {
+                V B[5];
+#pragma GCC unroll 5
+                for (unsigned x = 0; x < 5; ++x) {
+                    B[x] = A[x + y];
+                }
+#pragma GCC unroll 5
+                for (unsigned x = 0; x < 5; ++x) {
+                    A[x + y] = B[x] ^ (~B[(x + 1) % 5] & B[(x + 2) % 5]);
+                }
+            }
+            // iota
+            A[0] ^= ROUND_CONSTANTS[round];
+        }
+    }
+
+    template <class V, size_t N>
+    void absorb_block(V *const A, unsigned char const *const *const blocks)
+    {
+        for (size_t w = 0; w < BLOCK_WORDS; ++w) {
+            V word = {};
+            for (size_t i = 0; i < N; ++i) {
+                uint64_t v;
+                std::memcpy(&v, blocks[i] + w * sizeof(uint64_t), sizeof(v));
+                word[i] = v;
+            }
+            A[w] ^= word;
+        }
+        keccak_f1600(A);
+    }
+
+    // keccak256 of N messages of the same length at once
+    template <class V, size_t N>
+    void keccak256_lanes(
+        unsigned char const *const *const in, size_t const len,
+        unsigned char *const *const out)
+    {
+        V A[25] = {};
+        unsigned char const *blocks[N];
+
+        size_t offset = 0;
+        for (; len - offset >= BLOCK_SIZE; offset += BLOCK_SIZE) {
+            for (size_t i = 0; i < N; ++i) {
+                blocks[i] = in[i] + offset;
+            }
+            absorb_block<V, N>(A, blocks);
+        }
+
+        unsigned char last[N][BLOCK_SIZE];
+        size_t const rem = len - offset;
+        for (size_t i = 0; i < N; ++i) {
+            if (rem > 0) {
+                std::memcpy(last[i], in[i] + offset, rem);
+            }
+            std::memset(&last[i][rem], 0, BLOCK_SIZE - rem);
+            last[i][rem] = 0x01;
+            last[i][BLOCK_SIZE - 1] |= 0x80;
+            blocks[i] = last[i];
+        }
+        absorb_block<V, N>(A, blocks);
+
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t w = 0; w < KECCAK256_SIZE / sizeof(uint64_t); ++w) {
+                uint64_t const v = A[w][i];
+                std::memcpy(out[i] + w * sizeof(uint64_t), &v, sizeof(v));
+            }
+        }
+    }
+}
+
+void keccak256_x4(
+    unsigned char const *const in[4], unsigned long const len,
+    unsigned char *const out[4])
+{
+    keccak256_lanes<Lanes4, 4>(in, len, out);
+}
+
+void keccak256_x8(
+    unsigned char const *const in[8], unsigned long const len,
+    unsigned char *const out[8])
+{
+#if defined(__AVX512F__)
+    keccak256_lanes<Lanes8, 8>(in, len, out);
+#else
+    keccak256_x4(in, len, out);
+    keccak256_x4(in + 4, len, out + 4);
+#endif
+}
@@ -0,0 +1,429 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#pragma once
+
+#include <category/core/assert.h>
+#include <category/core/config.hpp>
+#include <category/core/synchronization/spin_lock.hpp>
+
+#include <tbb/concurrent_hash_map.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+MONAD_NAMESPACE_BEGIN
+
+/// Concurrent cache with the interface of LruCache and CLOCK replacement.
+///
+/// A hit only sets the reference bit of the entry, it takes no lock of the
+/// cache. Entries are spread over shards by key, each with its own lock and
+/// clock, so inserts into different shards do not contend. An insert into a
+/// full shard sweeps its clock: referenced entries get a second chance and
+/// the first entry not referenced since the previous sweep is evicted.
+///
+/// The max size can be changed at run time up to the capacity given at
+/// construction. A shrunk shard evicts one extra entry per insert until it
+/// fits. Evicted keys are remembered in a ghost table, and a miss on a
+/// remembered key counts as a ghost hit: a hit the cache would have had
+/// with about `ghost_size()` more entries.
+template <
+    class Key, class Value, class KeyHashCompare = tbb::tbb_hash_compare<Key>>
+class ClockCache
+{
+    /// TYPES
+    struct HashMapValue;
+    struct Slot;
+    struct Shard;
+    using HashMap = tbb::concurrent_hash_map<Key, HashMapValue, KeyHashCompare>;
+    using Accessor = HashMap::accessor;
+
+public:
+    using ConstAccessor = HashMap::const_accessor;
+
+    struct Stats
+    {
+        uint64_t hits;
+        uint64_t misses;
+        uint64_t evictions;
+        uint64_t ghost_hits;
+    };
+
+private:
+    /// CONSTANTS
+    static constexpr size_t MAX_SHARDS = 64;
+    static constexpr size_t MIN_SHARD_SIZE = 64;
+    static constexpr size_t MIN_GHOST_SIZE = 64;
+    static constexpr size_t SLACK = 16;
+
+    /// DATA
+    size_t capacity_;
+    size_t n_shards_;
+    size_t shard_capacity_;
+    unsigned shard_shift_;
+    size_t ghost_size_;
+    std::atomic<size_t> max_size_;
+    std::atomic<size_t> size_;
+    std::unique_ptr<Shard[]> shards_;
+    std::unique_ptr<std::atomic<uint64_t>[]> ghost_;
+    Stats printed_{};
+    HashMap hmap_;
+
+public:
+    // memory for `capacity` entries is reserved but only touched as the
+    // cache fills up
+    explicit ClockCache(size_t const max_size, size_t const capacity = 0)
+        : capacity_{std::max(max_size, capacity)}
+        , n_shards_{
+              capacity_ >= MAX_SHARDS * MIN_SHARD_SIZE ? MAX_SHARDS : 1}
+        , shard_capacity_{(capacity_ + n_shards_ - 1) / n_shards_}
+        , shard_shift_{static_cast<unsigned>(64 - std::countr_zero(n_shards_))}
+        , ghost_size_{std::bit_ceil(std::max(capacity_ / 32, MIN_GHOST_SIZE))}
+        , max_size_{0}
+        , size_{0}
+        , shards_{std::make_unique<Shard[]>(n_shards_)}
+        , ghost_{std::make_unique<std::atomic<uint64_t>[]>(ghost_size_)}
+        , hmap_(max_size + SLACK)
+    {
+        MONAD_ASSERT(max_size > 0);
+        for (size_t i = 0; i < n_shards_; ++i) {
+            shards_[i].allocate(shard_capacity_);
+        }
+        set_max_size(max_size);
+    }
+
+    ClockCache(ClockCache const &) = delete;
+    ClockCache &operator=(ClockCache const &) = delete;
+
+    bool find(ConstAccessor &acc, Key const &key)
+    {
+        uint64_t const hash = mix(key);
+        Shard &shard = shard_of(hash);
+        if (!hmap_.find(acc, key)) {
+            shard.counters.misses.fetch_add(1, std::memory_order_relaxed);
+            auto &ghost = ghost_[ghost_index(hash)];
+            if (ghost.load(std::memory_order_relaxed) == fingerprint(hash)) {
+                ghost.store(0, std::memory_order_relaxed);
+                shard.counters.ghost_hits.fetch_add(
+                    1, std::memory_order_relaxed);
+            }
+            return false;
+        }
+        shard.counters.hits.fetch_add(1, std::memory_order_relaxed);
+        auto &referenced = *acc->second.referenced_;
+        if (!referenced.load(std::memory_order_relaxed)) {
+            referenced.store(true, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    bool insert(Key const &key, Value const &value)
+    {
+        Key victims[2];
+        size_t n_victims = 0;
+        {
+            Accessor acc;
+            if (!hmap_.insert(acc, std::make_pair(key, HashMapValue{value}))) {
+                acc->second.value_ = value;
+                acc->second.referenced_->store(
+                    true, std::memory_order_relaxed);
+                return false;
+            }
+            // the new entry is not visible until it owns a slot
+            Shard &shard = shard_of(mix(key));
+            std::unique_lock const l{shard.lock};
+            size_t const limit = shard.limit.load(std::memory_order_relaxed);
+            if (shard.live < limit) {
+                acc->second.referenced_ = &shard.add(key).referenced;
+                size_.fetch_add(1, std::memory_order_acq_rel);
+                return true;
+            }
+            if (shard.live > limit) {
+                Slot &extra = sweep(shard);
+                victims[n_victims++] = extra.key;
+                shard.remove(extra);
+                size_.fetch_sub(1, std::memory_order_acq_rel);
+            }
+            Slot &slot = sweep(shard);
+            victims[n_victims++] = slot.key;
+            slot.key = key;
+            slot.referenced.store(false, std::memory_order_relaxed);
+            acc->second.referenced_ = &slot.referenced;
+            shard.counters.evictions.fetch_add(
+                n_victims, std::memory_order_relaxed);
+        }
+        // the victims left their slots, a hit on one until it is erased
+        // only gives a second chance to the new occupant of its slot
+        for (size_t i = 0; i < n_victims; ++i) {
+            ghost_[ghost_index(mix(victims[i]))].store(
+                fingerprint(mix(victims[i])), std::memory_order_relaxed);
+            hmap_.erase(victims[i]);
+        }
+        return true;
+    }
+
+    void clear() // Not thread-safe with other cache operations
+    {
+        hmap_.clear();
+        for (size_t i = 0; i < n_shards_; ++i) {
+            shards_[i].reset();
+        }
+        size_.store(0, std::memory_order_release);
+    }
+
+    size_t size() const
+    {
+        return size_.load(std::memory_order_acquire);
+    }
+
+    size_t max_size() const
+    {
+        return max_size_.load(std::memory_order_acquire);
+    }
+
+    size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    // estimate of the memory used per entry, including the hash map node
+    static constexpr size_t entry_bytes()
+    {
+        return sizeof(Slot) + sizeof(std::pair<Key, HashMapValue>) +
+               4 * sizeof(void *);
+    }
+
+    size_t ghost_size() const
+    {
+        return ghost_size_;
+    }
+
+    // clamped to [number of shards, capacity]
+    void set_max_size(size_t const max_size)
+    {
+        size_t const n = std::clamp(max_size, n_shards_, capacity_);
+        max_size_.store(n, std::memory_order_release);
+        for (size_t i = 0; i < n_shards_; ++i) {
+            size_t const limit = n / n_shards_ + (i < n % n_shards_ ? 1 : 0);
+            shards_[i].limit.store(limit, std::memory_order_relaxed);
+        }
+    }
+
+    // at most `max` keys, those referenced since the last sweep of their
+    // shard first
+    std::vector<Key> keys(size_t const max)
+    {
+        std::vector<Key> keys;
+        for (bool const referenced : {true, false}) {
+            for (size_t i = 0; i < n_shards_ && keys.size() < max; ++i) {
+                Shard &shard = shards_[i];
+                std::unique_lock const l{shard.lock};
+                for (size_t j = 0; j < shard.used && keys.size() < max; ++j) {
+                    Slot const &slot = shard.slots[j];
+                    if (slot.live && slot.referenced.load(
+                                         std::memory_order_relaxed) ==
+                                         referenced) {
+                        keys.push_back(slot.key);
+                    }
+                }
+            }
+        }
+        return keys;
+    }
+
+    // totals since construction
+    Stats stats() const
+    {
+        Stats stats{};
+        for (size_t i = 0; i < n_shards_; ++i) {
+            auto const &counters = shards_[i].counters;
+            stats.hits += counters.hits.load(std::memory_order_relaxed);
+            stats.misses += counters.misses.load(std::memory_order_relaxed);
+            stats.evictions +=
+                counters.evictions.load(std::memory_order_relaxed);
+            stats.ghost_hits +=
+                counters.ghost_hits.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+    // size / max size and the stats since the previous call
+    std::string print_stats()
+    {
+        Stats const stats = this->stats();
+        std::string str = std::format(
+            "{:8}/{:8} {:6} {:6} - {:6} - {:6}",
+            size(),
+            max_size(),
+            stats.hits - printed_.hits,
+            stats.misses - printed_.misses,
+            stats.evictions - printed_.evictions,
+            stats.ghost_hits - printed_.ghost_hits);
+        printed_ = stats;
+        return str;
+    }
+
+private:
+    static uint64_t mix(Key const &key)
+    {
+        // the hash map uses the low bits of the hash, mix the high bits in
+        return static_cast<uint64_t>(KeyHashCompare{}.hash(key)) *
+               0x9e3779b97f4a7c15ull;
+    }
+
+    static uint64_t fingerprint(uint64_t const hash)
+    {
+        return hash | 1; // 0 is an empty ghost
+    }
+
+    size_t ghost_index(uint64_t const hash) const
+    {
+        return (hash >> 32) & (ghost_size_ - 1);
+    }
+
+    Shard &shard_of(uint64_t const hash)
+    {
+        return shards_[n_shards_ == 1 ? 0 : hash >> shard_shift_];
+    }
+
+    // sweeps the clock of a full shard, with its lock held, and returns the
+    // first live slot not referenced since the previous sweep
+    static Slot &sweep(Shard &shard)
+    {
+        // after two rounds every entry had its second chance
+        for (size_t step = 0;; ++step) {
+            Slot &slot = shard.slots[shard.hand];
+            shard.hand = shard.hand + 1 == shard.used ? 0 : shard.hand + 1;
+            if (!slot.live) {
+                continue;
+            }
+            if (step >= 2 * shard.used ||
+                !slot.referenced.exchange(false, std::memory_order_relaxed)) {
+                return slot;
+            }
+        }
+    }
+
+    /// HashMapValue
+    struct HashMapValue
+    {
+        Value value_;
+        // reference bit in the slot of the entry
+        std::atomic<bool> *referenced_{nullptr};
+
+        HashMapValue() {}
+
+        explicit HashMapValue(Value const &value)
+            : value_(value)
+        {
+        }
+    }; /// HashMapValue
+
+    /// Slot
+    struct Slot
+    {
+        Key key;
+        std::atomic<bool> referenced{false};
+        bool live{true};
+
+        explicit Slot(Key const &key_)
+            : key{key_}
+        {
+        }
+    }; /// Slot
+
+    /// Shard
+    struct alignas(64) Shard
+    {
+        SpinLock lock{};
+        // slots are constructed on first use, the memory of an empty cache
+        // is not touched
+        Slot *slots{nullptr};
+        size_t capacity{0};
+        size_t used{0};
+        size_t live{0};
+        size_t hand{0};
+        // slots of the entries evicted while shrinking
+        std::vector<Slot *> free{};
+        std::atomic<size_t> limit{0};
+
+        struct alignas(64) Counters
+        {
+            std::atomic<uint64_t> hits{0};
+            std::atomic<uint64_t> misses{0};
+            std::atomic<uint64_t> evictions{0};
+            std::atomic<uint64_t> ghost_hits{0};
+        } counters{};
+
+        Shard() = default;
+        Shard(Shard const &) = delete;
+        Shard &operator=(Shard const &) = delete;
+
+        ~Shard()
+        {
+            reset();
+            std::allocator<Slot>{}.deallocate(slots, capacity);
+        }
+
+        void allocate(size_t const n)
+        {
+            slots = std::allocator<Slot>{}.allocate(n);
+            capacity = n;
+        }
+
+        Slot &add(Key const &key)
+        {
+            ++live;
+            if (free.empty()) {
+                MONAD_ASSERT(used < capacity);
+                return *std::construct_at(&slots[used++], key);
+            }
+            Slot &slot = *free.back();
+            free.pop_back();
+            slot.key = key;
+            slot.referenced.store(false, std::memory_order_relaxed);
+            slot.live = true;
+            return slot;
+        }
+
+        void remove(Slot &slot)
+        {
+            slot.live = false;
+            slot.referenced.store(false, std::memory_order_relaxed);
+            free.push_back(&slot);
+            --live;
+        }
+
+        void reset()
+        {
+            std::destroy_n(slots, used);
+            free.clear();
+            used = 0;
+            live = 0;
+            hand = 0;
+        }
+    }; /// Shard
+}; /// ClockCache
+
+MONAD_NAMESPACE_END
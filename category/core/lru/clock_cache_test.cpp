@@ -0,0 +1,254 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#include <category/core/lru/clock_cache.hpp>
+#include <category/core/lru/lru_cache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace monad;
+
+TEST(ClockCache, evict_unreferenced)
+{
+    using Cache = ClockCache<int, int>;
+    Cache cache{3};
+    Cache::ConstAccessor acc;
+
+    EXPECT_TRUE(cache.insert(1, 0x123));
+    EXPECT_TRUE(cache.insert(2, 0xdead));
+    EXPECT_TRUE(cache.insert(3, 0xbeef));
+    EXPECT_EQ(cache.size(), 3);
+
+    // 1 and 3 get a second chance, 2 is evicted
+    ASSERT_TRUE(cache.find(acc, 1));
+    EXPECT_EQ(acc->second.value_, 0x123);
+    ASSERT_TRUE(cache.find(acc, 3));
+    acc.release();
+
+    EXPECT_TRUE(cache.insert(4, 0xcafe));
+    EXPECT_EQ(cache.size(), 3);
+    EXPECT_FALSE(cache.find(acc, 2));
+    ASSERT_TRUE(cache.find(acc, 1));
+    ASSERT_TRUE(cache.find(acc, 3));
+    ASSERT_TRUE(cache.find(acc, 4));
+    EXPECT_EQ(acc->second.value_, 0xcafe);
+    acc.release();
+
+    // update in place
+    EXPECT_FALSE(cache.insert(4, 100));
+    ASSERT_TRUE(cache.find(acc, 4));
+    EXPECT_EQ(acc->second.value_, 100);
+    acc.release();
+
+    // every entry is referenced, the sweep clears them all and evicts one
+    EXPECT_TRUE(cache.insert(5, 5));
+    EXPECT_EQ(cache.size(), 3);
+    ASSERT_TRUE(cache.find(acc, 5));
+    acc.release();
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_FALSE(cache.find(acc, 5));
+}
+
+TEST(ClockCache, resize)
+{
+    using Cache = ClockCache<int, int>;
+    Cache cache{4, 8};
+    Cache::ConstAccessor acc;
+    EXPECT_EQ(cache.max_size(), 4);
+    EXPECT_EQ(cache.capacity(), 8);
+
+    for (int i = 1; i <= 4; ++i) {
+        EXPECT_TRUE(cache.insert(i, i));
+    }
+    EXPECT_EQ(cache.size(), 4);
+
+    // a shrunk cache evicts two entries per insert until it fits
+    cache.set_max_size(2);
+    EXPECT_TRUE(cache.insert(5, 5));
+    EXPECT_EQ(cache.size(), 3);
+    EXPECT_TRUE(cache.insert(6, 6));
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.stats().evictions, 4);
+    for (int i = 1; i <= 4; ++i) {
+        EXPECT_FALSE(cache.find(acc, i));
+    }
+    ASSERT_TRUE(cache.find(acc, 5));
+    ASSERT_TRUE(cache.find(acc, 6));
+    acc.release();
+
+    // the evicted keys were remembered once
+    EXPECT_EQ(cache.stats().ghost_hits, 4);
+    EXPECT_FALSE(cache.find(acc, 1));
+    EXPECT_EQ(cache.stats().ghost_hits, 4);
+    EXPECT_EQ(cache.stats().hits, 2);
+    EXPECT_EQ(cache.stats().misses, 5);
+
+    // grown up to the capacity, the freed slots are reused
+    cache.set_max_size(100);
+    EXPECT_EQ(cache.max_size(), 8);
+    for (int i = 7; i <= 12; ++i) {
+        EXPECT_TRUE(cache.insert(i, i));
+    }
+    EXPECT_EQ(cache.size(), 8);
+    EXPECT_EQ(cache.stats().evictions, 4);
+    EXPECT_TRUE(cache.insert(13, 13));
+    EXPECT_EQ(cache.size(), 8);
+    EXPECT_EQ(cache.stats().evictions, 5);
+}
+
+TEST(ClockCache, keys)
+{
+    using Cache = ClockCache<int, int>;
+    Cache cache{8};
+    Cache::ConstAccessor acc;
+    for (int i = 1; i <= 6; ++i) {
+        cache.insert(i, i);
+    }
+    ASSERT_TRUE(cache.find(acc, 5));
+    ASSERT_TRUE(cache.find(acc, 2));
+    acc.release();
+
+    auto const keys = cache.keys(100);
+    ASSERT_EQ(keys.size(), 6);
+    EXPECT_EQ(keys[0], 2);
+    EXPECT_EQ(keys[1], 5);
+    EXPECT_EQ(keys[2], 1);
+    EXPECT_EQ(cache.keys(2), (std::vector<int>{2, 5}));
+}
+
+TEST(ClockCache, concurrent)
+{
+    constexpr size_t max_size = 64 * 1024;
+    constexpr unsigned n_threads = 8;
+    constexpr uint64_t n_keys = 4 * max_size;
+
+    ClockCache<uint64_t, uint64_t> cache{max_size};
+    // gtest assertions only stop the thread they fail on, so the threads
+    // count the wrong values and the test checks them once joined
+    std::atomic<uint64_t> n_wrong{0};
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < n_threads; ++t) {
+        threads.emplace_back([&cache, &n_wrong, t] {
+            std::mt19937_64 rng{t};
+            for (unsigned i = 0; i < 200'000; ++i) {
+                uint64_t const key = rng() % n_keys;
+                decltype(cache)::ConstAccessor acc;
+                if (cache.find(acc, key)) {
+                    if (acc->second.value_ != key * 3) {
+                        n_wrong.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    continue;
+                }
+                acc.release();
+                cache.insert(key, key * 3);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(n_wrong.load(), 0);
+    EXPECT_LE(cache.size(), max_size);
+    EXPECT_GT(cache.size(), max_size / 2);
+}
+
+namespace
+{
+    // zipfian trace over `n_keys` keys, hot keys scattered over the space
+    std::vector<uint64_t>
+    make_trace(size_t const n, uint64_t const n_keys, unsigned const seed)
+    {
+        std::vector<double> weights(n_keys);
+        for (uint64_t k = 0; k < n_keys; ++k) {
+            weights[k] = 1.0 / std::pow(static_cast<double>(k + 1), 0.9);
+        }
+        std::discrete_distribution<uint64_t> zipf{
+            weights.begin(), weights.end()};
+        std::mt19937_64 rng{seed};
+        std::vector<uint64_t> trace(n);
+        for (auto &key : trace) {
+            key = zipf(rng) * 0x9e3779b97f4a7c15ull;
+        }
+        return trace;
+    }
+
+    template <class Cache>
+    void replay(
+        char const *const name,
+        std::vector<std::vector<uint64_t>> const &traces,
+        size_t const max_size)
+    {
+        Cache cache{max_size};
+        std::atomic<uint64_t> hits{0};
+        std::vector<std::thread> threads;
+        auto const begin = std::chrono::steady_clock::now();
+        for (auto const &trace : traces) {
+            threads.emplace_back([&cache, &hits, &trace] {
+                uint64_t n = 0;
+                for (uint64_t const key : trace) {
+                    typename Cache::ConstAccessor acc;
+                    if (cache.find(acc, key)) {
+                        ++n;
+                        continue;
+                    }
+                    acc.release();
+                    cache.insert(key, key);
+                }
+                hits.fetch_add(n);
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        auto const elapsed = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - begin);
+        size_t total = 0;
+        for (auto const &trace : traces) {
+            total += trace.size();
+        }
+        std::cout << name << " threads=" << traces.size() << " hit rate="
+                  << static_cast<double>(hits.load()) /
+                         static_cast<double>(total)
+                  << " ops/s="
+                  << static_cast<double>(total) / elapsed.count()
+                  << std::endl;
+    }
+}
+
+TEST(ClockCache, DISABLED_benchmark)
+{
+    constexpr size_t max_size = 1 << 16;
+    constexpr uint64_t n_keys = 1 << 20;
+    constexpr size_t n_ops = 200'000;
+
+    for (unsigned const n_threads : {1u, 4u, 8u}) {
+        std::vector<std::vector<uint64_t>> traces;
+        for (unsigned t = 0; t < n_threads; ++t) {
+            traces.push_back(make_trace(n_ops, n_keys, t));
+        }
+        replay<LruCache<uint64_t, uint64_t>>("lru  ", traces, max_size);
+        replay<ClockCache<uint64_t, uint64_t>>("clock", traces, max_size);
+    }
+}
@@ -0,0 +1,161 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <category/core/config.hpp>
+#include <category/core/likely.h>
+#include <category/core/mem/batch_mem_pool.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+
+MONAD_NAMESPACE_BEGIN
+
+/// Monotonic memory resource for short lived objects, e.g. the state of a
+/// transaction attempt. Memory is carved out of fixed-size chunks that are
+/// drawn from a pool shared by all arenas, so allocating from many threads
+/// at once costs one pool lock per chunk instead of a malloc per
+/// allocation, and chunks stay faulted in from one block to the next.
+/// Deallocation is a no-op: all memory goes back to the pool at once when
+/// the arena is released or destroyed.
+///
+/// An arena is not thread safe, it is meant to be used by one fiber at a
+/// time.
+class ArenaResource final : public std::pmr::memory_resource
+{
+public:
+    static constexpr size_t CHUNK_SIZE = 16 * 1024;
+
+    struct Chunk
+    {
+        Chunk *next;
+        alignas(std::max_align_t) std::byte bytes[CHUNK_SIZE];
+    };
+
+    using ChunkPool = BatchMemPool<Chunk>;
+
+    static ChunkPool &default_pool()
+    {
+        static ChunkPool pool{64};
+        return pool;
+    }
+
+private:
+    // allocations larger than this do not waste the rest of a chunk
+    static constexpr size_t MAX_SMALL = CHUNK_SIZE / 4;
+
+    struct Large
+    {
+        Large *next;
+        size_t size;
+        size_t alignment;
+    };
+
+    ChunkPool &pool_;
+    Chunk *chunks_{nullptr};
+    Large *large_{nullptr};
+    std::byte *cur_{nullptr};
+    std::byte *end_{nullptr};
+
+    static size_t large_alignment(size_t const alignment)
+    {
+        return std::max(alignment, alignof(std::max_align_t));
+    }
+
+    // the header precedes the allocation and keeps it aligned
+    static size_t large_header(size_t const alignment)
+    {
+        size_t const align = large_alignment(alignment);
+        return (sizeof(Large) + align - 1) / align * align;
+    }
+
+    void *do_allocate(size_t const bytes, size_t const alignment) override
+    {
+        if (MONAD_UNLIKELY(
+                bytes > MAX_SMALL || alignment > alignof(std::max_align_t))) {
+            size_t const header = large_header(alignment);
+            auto *const p = static_cast<std::byte *>(::operator new(
+                header + bytes, std::align_val_t{large_alignment(alignment)}));
+            large_ = new (p + header - sizeof(Large))
+                Large{large_, bytes, alignment};
+            return p + header;
+        }
+        auto const align = [alignment](std::byte *const p) {
+            auto const addr = reinterpret_cast<uintptr_t>(p);
+            return reinterpret_cast<std::byte *>(
+                (addr + alignment - 1) & ~(uintptr_t{alignment} - 1));
+        };
+        std::byte *p = align(cur_);
+        if (MONAD_UNLIKELY(cur_ == nullptr || p + bytes > end_)) {
+            auto *const chunk = pool_.new_obj();
+            chunk->next = chunks_;
+            chunks_ = chunk;
+            cur_ = chunk->bytes;
+            end_ = chunk->bytes + CHUNK_SIZE;
+            p = align(cur_);
+        }
+        cur_ = p + bytes;
+        return p;
+    }
+
+    void do_deallocate(void *, size_t, size_t) override {}
+
+    bool do_is_equal(std::pmr::memory_resource const &other) const
+        noexcept override
+    {
+        return this == &other;
+    }
+
+public:
+    explicit ArenaResource(ChunkPool &pool = default_pool())
+        : pool_{pool}
+    {
+    }
+
+    ArenaResource(ArenaResource const &) = delete;
+    ArenaResource &operator=(ArenaResource const &) = delete;
+
+    ~ArenaResource() override
+    {
+        release();
+    }
+
+    // everything allocated from the arena must be destroyed beforehand
+    void release()
+    {
+        while (chunks_) {
+            auto *const next = chunks_->next;
+            pool_.delete_obj(chunks_);
+            chunks_ = next;
+        }
+        while (large_) {
+            auto *const next = large_->next;
+            size_t const header = large_header(large_->alignment);
+            auto *const p = reinterpret_cast<std::byte *>(large_ + 1) - header;
+            ::operator delete(
+                p, std::align_val_t{large_alignment(large_->alignment)});
+            large_ = next;
+        }
+        cur_ = nullptr;
+        end_ = nullptr;
+    }
+};
+
+MONAD_NAMESPACE_END
@@ -0,0 +1,126 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/core/mem/arena_resource.hpp>
+
+#include <category/core/test_util/gtest_signal_stacktrace_printer.hpp> // NOLINT
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace monad;
+
+namespace
+{
+    bool is_aligned(void const *const p, size_t const alignment)
+    {
+        return reinterpret_cast<uintptr_t>(p) % alignment == 0;
+    }
+
+    // fills the allocations with their index and checks that none overwrote
+    // another
+    void check_disjoint(std::vector<std::pair<void *, size_t>> const &allocs)
+    {
+        for (size_t i = 0; i < allocs.size(); ++i) {
+            std::memset(allocs[i].first, static_cast<int>(i), allocs[i].second);
+        }
+        for (size_t i = 0; i < allocs.size(); ++i) {
+            auto const *const p =
+                static_cast<unsigned char const *>(allocs[i].first);
+            for (size_t j = 0; j < allocs[i].second; ++j) {
+                ASSERT_EQ(p[j], static_cast<unsigned char>(i));
+            }
+        }
+    }
+}
+
+TEST(ArenaResource, mixed_alignments)
+{
+    ArenaResource::ChunkPool pool{4};
+    ArenaResource arena{pool};
+    std::vector<std::pair<void *, size_t>> allocs;
+    for (size_t i = 0; i < 1000; ++i) {
+        // 64 and 4096 are over-aligned and take the large allocation path
+        for (size_t const alignment : {1, 2, 4, 8, 16, 64, 4096}) {
+            size_t const bytes = 1 + (i * 7 + alignment) % 97;
+            void *const p = arena.allocate(bytes, alignment);
+            ASSERT_TRUE(is_aligned(p, alignment));
+            allocs.emplace_back(p, bytes);
+        }
+    }
+    check_disjoint(allocs);
+}
+
+TEST(ArenaResource, larger_than_chunk)
+{
+    ArenaResource::ChunkPool pool{4};
+    ArenaResource arena{pool};
+    std::vector<std::pair<void *, size_t>> allocs;
+    for (size_t const bytes :
+         {size_t{8},
+          ArenaResource::CHUNK_SIZE / 4 + 1,
+          ArenaResource::CHUNK_SIZE,
+          size_t{8},
+          3 * ArenaResource::CHUNK_SIZE + 5}) {
+        void *const p = arena.allocate(bytes, 8);
+        ASSERT_TRUE(is_aligned(p, 8));
+        allocs.emplace_back(p, bytes);
+    }
+    void *const p = arena.allocate(2 * ArenaResource::CHUNK_SIZE, 256);
+    ASSERT_TRUE(is_aligned(p, 256));
+    allocs.emplace_back(p, 2 * ArenaResource::CHUNK_SIZE);
+    check_disjoint(allocs);
+}
+
+TEST(ArenaResource, reuse_after_release)
+{
+    ArenaResource::ChunkPool pool{4};
+    ArenaResource arena{pool};
+
+    // the first allocation of a chunk is at its start
+    std::set<void *> chunks;
+    void *prev = nullptr;
+    for (size_t i = 0; i < 3 * ArenaResource::CHUNK_SIZE / 64; ++i) {
+        void *const p = arena.allocate(64, 8);
+        if (prev == nullptr || static_cast<std::byte *>(p) !=
+                                   static_cast<std::byte *>(prev) + 64) {
+            chunks.insert(p);
+        }
+        prev = p;
+    }
+    EXPECT_EQ(chunks.size(), 3);
+    // a large allocation, released with the chunks
+    EXPECT_NE(arena.allocate(ArenaResource::CHUNK_SIZE, 8), nullptr);
+
+    // the chunks went back to the pool and are handed out again
+    arena.release();
+    EXPECT_TRUE(chunks.contains(arena.allocate(64, 8)));
+
+    // containers use the arena as a memory resource
+    std::pmr::vector<uint64_t> v{&arena};
+    for (uint64_t i = 0; i < 10'000; ++i) {
+        v.push_back(i);
+    }
+    for (uint64_t i = 0; i < 10'000; ++i) {
+        ASSERT_EQ(v[i], i);
+    }
+}
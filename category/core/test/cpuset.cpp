@@ -18,6 +18,7 @@
 #include <category/core/cleanup.h> // NOLINT(misc-include-cleaner)
 #include <category/core/cpuset.h>
 
+#include <errno.h>
 #include <sched.h>
 #include <string.h>
 
@@ -68,3 +69,24 @@ TEST(Cpuset, parse_empty)
     auto set = monad_parse_cpuset(evens);
     EXPECT_TRUE(CPU_EQUAL(&empty, &set));
 }
+
+TEST(Cpuset, try_parse)
+{
+    cpu_set_t set;
+    EXPECT_EQ(monad_try_parse_cpuset("0,2-3,64", &set), 0);
+    EXPECT_EQ(CPU_COUNT(&set), 4);
+    EXPECT_TRUE(static_cast<bool>(CPU_ISSET(0, &set)));
+    EXPECT_TRUE(static_cast<bool>(CPU_ISSET(2, &set)));
+    EXPECT_TRUE(static_cast<bool>(CPU_ISSET(3, &set)));
+    EXPECT_TRUE(static_cast<bool>(CPU_ISSET(64, &set)));
+}
+
+TEST(Cpuset, try_parse_invalid)
+{
+    cpu_set_t set;
+    for (char const *const s :
+         {"", ",", "0,", ",0", "abc", "1x", "1-", "-1", "3-1", " 1", "+1",
+          "0--2", "1,,2", "99999999999999999999", "1024"}) {
+        EXPECT_EQ(monad_try_parse_cpuset(s, &set), EINVAL) << s;
+    }
+}
@@ -0,0 +1,126 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/core/byte_string.hpp>
+#include <category/core/hex_literal.hpp>
+#include <category/core/keccak.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace monad;
+using namespace monad::literals;
+
+namespace
+{
+    std::vector<byte_string> random_messages(size_t const n, size_t const len)
+    {
+        std::mt19937_64 gen{len};
+        std::uniform_int_distribution<unsigned> dist{0, 255};
+        std::vector<byte_string> messages(n);
+        for (auto &message : messages) {
+            message.resize(len);
+            for (auto &b : message) {
+                b = static_cast<unsigned char>(dist(gen));
+            }
+        }
+        return messages;
+    }
+
+    byte_string_view bytes(hash256 const &hash)
+    {
+        return to_byte_string_view(hash.bytes);
+    }
+}
+
+TEST(Keccak, empty)
+{
+    EXPECT_EQ(
+        bytes(keccak256(byte_string_view{})),
+        0xc5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470_hex);
+}
+
+TEST(Keccak, multi_buffer)
+{
+    // covers every padding position of the first blocks
+    for (size_t len = 0; len <= 600; ++len) {
+        auto const messages = random_messages(8, len);
+        unsigned char const *in[8];
+        hash256 hashes[8];
+        unsigned char *out[8];
+        for (size_t i = 0; i < 8; ++i) {
+            in[i] = messages[i].data();
+            out[i] = hashes[i].bytes;
+        }
+
+        keccak256_x8(in, len, out);
+        for (size_t i = 0; i < 8; ++i) {
+            EXPECT_EQ(bytes(hashes[i]), bytes(keccak256(messages[i]))) << len;
+        }
+
+        keccak256_x4(in + 4, len, out);
+        for (size_t i = 0; i < 4; ++i) {
+            EXPECT_EQ(bytes(hashes[i]), bytes(keccak256(messages[i + 4])))
+                << len;
+        }
+    }
+}
+
+TEST(Keccak, span)
+{
+    // runs of equal lengths are broken up by messages of other lengths
+    std::vector<byte_string> messages;
+    for (size_t const len : {32, 32, 32, 32, 32, 32, 32, 32, 32, 20, 20, 20,
+                             20, 20, 136, 135, 137, 137, 137, 137}) {
+        messages.push_back(random_messages(1, len)[0]);
+    }
+    std::vector<byte_string_view> in(messages.begin(), messages.end());
+    std::vector<hash256> out(messages.size());
+    keccak256(in, out);
+    for (size_t i = 0; i < messages.size(); ++i) {
+        EXPECT_EQ(bytes(out[i]), bytes(keccak256(messages[i]))) << i;
+    }
+}
+
+TEST(Keccak, DISABLED_benchmark)
+{
+    constexpr size_t N = 1 << 16;
+    for (size_t const len : {32, 64, 136, 300, 532, 600}) {
+        auto const messages = random_messages(N, len);
+        std::vector<byte_string_view> in(messages.begin(), messages.end());
+        std::vector<hash256> out(N);
+        auto const rate = [&](auto const &hash) {
+            auto const begin = std::chrono::steady_clock::now();
+            hash();
+            auto const elapsed = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - begin);
+            return static_cast<double>(N) / elapsed.count();
+        };
+        double const scalar = rate([&] {
+            for (size_t i = 0; i < N; ++i) {
+                out[i] = keccak256(in[i]);
+            }
+        });
+        double const batched = rate([&] { keccak256(in, out); });
+        std::cout << "   " << len << " bytes: " << scalar
+                  << " hashes/s, batched " << batched << " hashes/s"
+                  << std::endl;
+    }
+}
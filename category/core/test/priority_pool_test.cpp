@@ -17,6 +17,9 @@
 
 #include <category/core/fiber/priority_pool.hpp>
 
+#include <boost/fiber/future/future.hpp>
+#include <boost/fiber/future/promise.hpp>
+
 #include <category/core/test_util/gtest_signal_stacktrace_printer.hpp> // NOLINT
 
 #include <atomic>
@@ -24,9 +27,56 @@
 #include <cstddef>
 #include <functional>
 #include <iostream>
+#include <optional>
 #include <thread>
 #include <vector>
 
+#include <sched.h>
+
+TEST(PriorityPool, wake_across_threads)
+{
+    // every task waits on its predecessor, so fibers are woken by fibers
+    // that ran on other threads and have to be picked from other shards
+    constexpr unsigned N = 1000;
+    std::vector<boost::fibers::promise<void>> promises(N);
+    std::atomic<unsigned> done{0};
+    {
+        monad::fiber::PriorityPool pool{4, 32};
+        for (unsigned i = 0; i < N; ++i) {
+            pool.submit(i, [&, i] {
+                if (i > 0) {
+                    promises[i - 1].get_future().wait();
+                }
+                done.fetch_add(1, std::memory_order_relaxed);
+                promises[i].set_value();
+            });
+        }
+    }
+    EXPECT_EQ(done.load(), N);
+}
+
+TEST(PriorityPool, pin_threads)
+{
+    int const cpu = sched_getcpu();
+    ASSERT_GE(cpu, 0);
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+
+    std::atomic<unsigned> pinned{0};
+    {
+        monad::fiber::PriorityPool pool{2, 8, false, cpus};
+        for (unsigned i = 0; i < 100; ++i) {
+            pool.submit(i, [&] {
+                if (sched_getcpu() == cpu) {
+                    pinned.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+    }
+    EXPECT_EQ(pinned.load(), 100u);
+}
+
 /* On Niall's machine, for reference:
 
 PriorityPool executed 700000 ops which is 126020 ops/sec.
@@ -0,0 +1,179 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#include <category/core/assert.h>
+#include <category/core/byte_string.hpp>
+#include <category/core/fiber/priority_pool.hpp>
+#include <category/core/keccak.hpp>
+#include <category/execution/ethereum/core/address.hpp>
+#include <category/execution/ethereum/core/rlp/transaction_rlp.hpp>
+#include <category/execution/ethereum/core/transaction.hpp>
+#include <category/execution/ethereum/execute_block.hpp>
+
+#include <CLI/CLI.hpp>
+
+#include <boost/fiber/future/promise.hpp>
+
+#include <intx/intx.hpp>
+
+#include <secp256k1.h>
+#include <secp256k1_recovery.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+using namespace monad;
+
+namespace
+{
+    // legacy transactions signed by `n_keys` different keys
+    std::vector<Transaction>
+    make_transactions(size_t const n, size_t const n_keys)
+    {
+        std::unique_ptr<
+            secp256k1_context,
+            decltype(&secp256k1_context_destroy)> const
+            context(
+                secp256k1_context_create(SECP256K1_CONTEXT_NONE),
+                &secp256k1_context_destroy);
+
+        std::vector<Transaction> transactions(n);
+        for (size_t i = 0; i < n; ++i) {
+            auto &transaction = transactions[i];
+            transaction.nonce = i / n_keys;
+            transaction.gas_limit = 21'000;
+            transaction.max_fee_per_gas = 1'000'000'000;
+            transaction.value = i;
+            transaction.to = Address{};
+            transaction.sc.chain_id = 1;
+
+            bytes32_t key{};
+            key.bytes[0] = 1;
+            key.bytes[31] = static_cast<uint8_t>(i % n_keys);
+            key.bytes[30] = static_cast<uint8_t>((i % n_keys) >> 8);
+
+            auto const hash =
+                keccak256(rlp::encode_transaction_for_signing(transaction));
+            secp256k1_ecdsa_recoverable_signature signature;
+            MONAD_ASSERT(secp256k1_ecdsa_sign_recoverable(
+                context.get(),
+                &signature,
+                hash.bytes,
+                key.bytes,
+                nullptr,
+                nullptr));
+            uint8_t compact[64];
+            int recid;
+            MONAD_ASSERT(
+                secp256k1_ecdsa_recoverable_signature_serialize_compact(
+                    context.get(), compact, &recid, &signature));
+            transaction.sc.r = intx::be::unsafe::load<uint256_t>(compact);
+            transaction.sc.s = intx::be::unsafe::load<uint256_t>(compact + 32);
+            transaction.sc.y_parity = static_cast<uint8_t>(recid);
+        }
+        return transactions;
+    }
+
+    // one task per signature, as sender recovery used to submit them
+    std::vector<std::optional<Address>> recover_one_by_one(
+        std::vector<Transaction> const &transactions,
+        fiber::PriorityPool &priority_pool)
+    {
+        std::vector<std::optional<Address>> senders{transactions.size()};
+        std::unique_ptr<boost::fibers::promise<void>[]> const promises{
+            new boost::fibers::promise<void>[transactions.size()]};
+        for (size_t i = 0; i < transactions.size(); ++i) {
+            priority_pool.submit(
+                i,
+                [&sender = senders[i],
+                 &transaction = transactions[i],
+                 &promise = promises[i]] {
+                    sender = recover_sender(transaction);
+                    promise.set_value();
+                });
+        }
+        for (size_t i = 0; i < transactions.size(); ++i) {
+            promises[i].get_future().wait();
+        }
+        return senders;
+    }
+
+    template <class Recover>
+    double signatures_per_second(
+        size_t const n_signatures, unsigned const repeat, Recover &&recover)
+    {
+        auto const begin = std::chrono::steady_clock::now();
+        for (unsigned r = 0; r < repeat; ++r) {
+            recover();
+        }
+        auto const elapsed = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - begin);
+        return static_cast<double>(n_signatures * repeat) / elapsed.count();
+    }
+}
+
+int main(int const argc, char const *argv[])
+{
+    size_t n_transactions = 5'000;
+    size_t n_keys = 1'000;
+    unsigned repeat = 10;
+    std::vector<unsigned> threads{
+        1, 2, 4, 8, std::max(1u, std::thread::hardware_concurrency())};
+
+    CLI::App cli{"sender_recovery_bench"};
+    cli.add_option(
+        "--transactions", n_transactions, "transactions of the block");
+    cli.add_option("--keys", n_keys, "distinct signers of the block");
+    cli.add_option("--repeat", repeat, "recoveries of the block");
+    cli.add_option("--threads", threads, "pool sizes to measure");
+    CLI11_PARSE(cli, argc, argv);
+    MONAD_ASSERT(n_keys > 0 && n_keys <= 1 << 16);
+
+    auto const transactions = make_transactions(n_transactions, n_keys);
+
+    double const single = signatures_per_second(n_transactions, repeat, [&] {
+        for (auto const &transaction : transactions) {
+            MONAD_ASSERT(recover_sender(transaction).has_value());
+        }
+    });
+    std::printf("single thread: %.0f signatures/s\n", single);
+
+    for (unsigned const n_threads : threads) {
+        fiber::PriorityPool pool{n_threads, n_threads * 4};
+        double const one_by_one =
+            signatures_per_second(n_transactions, repeat, [&] {
+                recover_one_by_one(transactions, pool);
+            });
+        double const chunked =
+            signatures_per_second(n_transactions, repeat, [&] {
+                recover_senders(transactions, pool);
+            });
+        std::printf(
+            "%3u threads: one by one %.0f signatures/s (%.0f per core), "
+            "chunked %.0f signatures/s (%.0f per core)\n",
+            n_threads,
+            one_by_one,
+            one_by_one / n_threads,
+            chunked,
+            chunked / n_threads);
+    }
+    return 0;
+}
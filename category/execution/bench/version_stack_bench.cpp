@@ -0,0 +1,184 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#include <category/core/assert.h>
+#include <category/execution/ethereum/core/account.hpp>
+#include <category/execution/ethereum/state3/account_state.hpp>
+#include <category/execution/ethereum/state3/version_stack.hpp>
+
+#include <CLI/CLI.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <initializer_list>
+#include <optional>
+#include <utility>
+#include <vector>
+
+using namespace monad;
+
+namespace
+{
+    // VersionStack as it was before the inline versions, every stack
+    // allocates its deque map and first block, and a push may allocate
+    template <class T>
+    class DequeVersionStack
+    {
+        std::deque<std::pair<unsigned, T>> stack_{};
+
+    public:
+        DequeVersionStack(T value, unsigned version = 0)
+        {
+            stack_.emplace_back(version, std::move(value));
+        }
+
+        T &current(unsigned const version)
+        {
+            if (version > stack_.back().first) {
+                T value = stack_.back().second;
+                stack_.emplace_back(version, std::move(value));
+            }
+            return stack_.back().second;
+        }
+
+        void pop_accept(unsigned const version)
+        {
+            auto const size = stack_.size();
+            if (version == stack_.back().first) {
+                if (size > 1 &&
+                    stack_[size - 2].first + 1 == stack_[size - 1].first) {
+                    stack_[size - 2].second =
+                        std::move(stack_[size - 1].second);
+                    stack_.pop_back();
+                }
+                else {
+                    stack_.back().first = version - 1;
+                }
+            }
+        }
+
+        bool pop_reject(unsigned const version)
+        {
+            if (version == stack_.back().first) {
+                stack_.pop_back();
+            }
+            return stack_.empty();
+        }
+    };
+
+    struct CallTree
+    {
+        size_t accounts;
+        unsigned depth;
+        unsigned fanout;
+        unsigned reject_every;
+    };
+
+    // one transaction: a stack per account, then a call tree in which
+    // every call bumps the balance of its caller and callee and is popped
+    // like State::pop_accept / State::pop_reject
+    template <class Stack>
+    void run_transaction(CallTree const &tree)
+    {
+        std::vector<Stack> stacks;
+        stacks.reserve(tree.accounts);
+        for (size_t i = 0; i < tree.accounts; ++i) {
+            stacks.emplace_back(AccountState{Account{.nonce = i}});
+        }
+
+        unsigned version = 0;
+        uint64_t n_calls = 0;
+        auto const call = [&](auto const &self, size_t const caller) -> void {
+            ++version;
+            size_t const callee = (caller * 7 + n_calls + 1) % tree.accounts;
+            ++n_calls;
+            for (size_t const i : {caller, callee}) {
+                auto &account = stacks[i].current(version).account_;
+                account->balance += 1;
+            }
+            if (version < tree.depth) {
+                for (unsigned f = 0; f < tree.fanout; ++f) {
+                    self(self, callee);
+                }
+            }
+            if (tree.reject_every && n_calls % tree.reject_every == 0) {
+                for (auto &stack : stacks) {
+                    MONAD_ASSERT(!stack.pop_reject(version));
+                }
+            }
+            else {
+                for (auto &stack : stacks) {
+                    stack.pop_accept(version);
+                }
+            }
+            --version;
+        };
+        call(call, 0);
+    }
+
+    template <class Stack>
+    double transactions_per_second(CallTree const &tree, unsigned const repeat)
+    {
+        auto const begin = std::chrono::steady_clock::now();
+        for (unsigned r = 0; r < repeat; ++r) {
+            run_transaction<Stack>(tree);
+        }
+        auto const elapsed = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - begin);
+        return static_cast<double>(repeat) / elapsed.count();
+    }
+}
+
+int main(int const argc, char const *argv[])
+{
+    size_t accounts = 16;
+    unsigned fanout = 2;
+    unsigned reject_every = 8;
+    unsigned repeat = 10'000;
+    std::vector<unsigned> depths{1, 2, 3, 4, 6, 8};
+
+    CLI::App cli{"version_stack_bench"};
+    cli.add_option("--accounts", accounts, "accounts touched per transaction");
+    cli.add_option("--fanout", fanout, "calls made by every call");
+    cli.add_option(
+        "--reject_every", reject_every, "revert every n-th call, 0 for none");
+    cli.add_option("--repeat", repeat, "transactions per measurement");
+    cli.add_option("--depths", depths, "call depths to measure");
+    CLI11_PARSE(cli, argc, argv);
+    MONAD_ASSERT(accounts > 0);
+
+    for (unsigned const depth : depths) {
+        CallTree const tree{
+            .accounts = accounts,
+            .depth = depth,
+            .fanout = fanout,
+            .reject_every = reject_every};
+        double const deque =
+            transactions_per_second<DequeVersionStack<AccountState>>(
+                tree, repeat);
+        double const inline2 =
+            transactions_per_second<VersionStack<AccountState>>(tree, repeat);
+        std::printf(
+            "depth %2u: deque %.0f transactions/s, inline N=2 %.0f "
+            "transactions/s (%.2fx)\n",
+            depth,
+            deque,
+            inline2,
+            inline2 / deque);
+    }
+    return 0;
+}
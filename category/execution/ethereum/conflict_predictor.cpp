@@ -0,0 +1,98 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/core/assert.h>
+#include <category/core/config.hpp>
+#include <category/execution/ethereum/conflict_predictor.hpp>
+#include <category/execution/ethereum/core/address.hpp>
+#include <category/execution/ethereum/core/block.hpp>
+#include <category/execution/ethereum/core/transaction.hpp>
+#include <category/execution/ethereum/metrics/block_metrics.hpp>
+
+#include <ankerl/unordered_dense.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+MONAD_NAMESPACE_BEGIN
+
+bool ConflictPredictor::is_hot(Address const &address) const
+{
+    auto const it = scores_.find(address);
+    return it != scores_.end() && it->second >= HOT;
+}
+
+std::vector<std::optional<uint64_t>> ConflictPredictor::predict(
+    Block const &block, std::vector<Address> const &senders) const
+{
+    MONAD_ASSERT(senders.size() == block.transactions.size());
+
+    std::vector<std::optional<uint64_t>> predecessors(senders.size());
+    if (scores_.empty()) {
+        return predecessors;
+    }
+
+    // last transaction touching each hot address
+    ankerl::unordered_dense::segmented_map<Address, uint64_t> last{};
+    auto const touch = [&](uint64_t const i, Address const &address) {
+        if (!is_hot(address)) {
+            return;
+        }
+        auto const [it, inserted] = last.try_emplace(address, i);
+        if (!inserted) {
+            if (it->second != i) {
+                predecessors[i] =
+                    std::max(predecessors[i].value_or(0), it->second);
+            }
+            it->second = i;
+        }
+    };
+
+    for (uint64_t i = 0; i < senders.size(); ++i) {
+        auto const &tx = block.transactions[i];
+        touch(i, senders[i]);
+        if (tx.to.has_value()) {
+            touch(i, tx.to.value());
+        }
+        for (auto const &ae : tx.access_list) {
+            touch(i, ae.a);
+        }
+    }
+    return predecessors;
+}
+
+void ConflictPredictor::update(
+    Block const &block, BlockMetrics const &block_metrics)
+{
+    for (auto &[address, score] : scores_) {
+        score *= DECAY;
+    }
+    std::erase_if(scores_, [](auto const &entry) {
+        return entry.second < FORGET;
+    });
+    for (auto const &[i, address] : block_metrics.conflicts()) {
+        scores_[address] += 1.0;
+        if (i < block.transactions.size()) {
+            auto const &to = block.transactions[i].to;
+            if (to.has_value() && to.value() != address) {
+                scores_[to.value()] += 1.0;
+            }
+        }
+    }
+}
+
+MONAD_NAMESPACE_END
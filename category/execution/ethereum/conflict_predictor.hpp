@@ -0,0 +1,68 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <category/core/config.hpp>
+#include <category/execution/ethereum/core/address.hpp>
+
+#include <ankerl/unordered_dense.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+MONAD_NAMESPACE_BEGIN
+
+class BlockMetrics;
+struct Block;
+
+// CONFLICT SCHEDULING
+// Rolling history of the addresses whose writes made transactions retry in
+// previous blocks, i.e. accounts and contracts that are contended. Each
+// retry bumps the score of the conflicting address and of the contract the
+// retried transaction called, and scores decay every block.
+//
+// predict() turns the history into a hint per transaction: the closest
+// earlier transaction of the block that touches the same hot address.
+// execute_block holds a transaction back until that predecessor merged,
+// instead of executing it speculatively against state that is likely to
+// change. The hints only affect when transactions start executing, never
+// the order in which they merge.
+class ConflictPredictor final
+{
+    static constexpr double DECAY = 0.75;
+    static constexpr double HOT = 0.5;
+    static constexpr double FORGET = 0.05;
+
+    ankerl::unordered_dense::segmented_map<Address, double> scores_{};
+
+public:
+    bool is_hot(Address const &) const;
+
+    std::vector<std::optional<uint64_t>>
+    predict(Block const &, std::vector<Address> const &senders) const;
+
+    // called once per executed block, with its retries
+    void update(Block const &, BlockMetrics const &);
+
+    size_t size() const
+    {
+        return scores_.size();
+    }
+};
+
+MONAD_NAMESPACE_END
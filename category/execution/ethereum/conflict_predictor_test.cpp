@@ -0,0 +1,123 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/execution/ethereum/conflict_predictor.hpp>
+#include <category/execution/ethereum/core/address.hpp>
+#include <category/execution/ethereum/core/block.hpp>
+#include <category/execution/ethereum/core/transaction.hpp>
+#include <category/execution/ethereum/metrics/block_metrics.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+using namespace monad;
+
+constexpr auto a{0xbebebebebebebebebebebebebebebebebebebebe_address};
+constexpr auto b{0x5353535353535353535353535353535353535353_address};
+constexpr auto c{0xa5a5a5a5a5a5a5a5a5a5a5a5a5a5a5a5a5a5a5a5_address};
+constexpr auto s1{0x1111111111111111111111111111111111111111_address};
+constexpr auto s2{0x2222222222222222222222222222222222222222_address};
+constexpr auto s3{0x3333333333333333333333333333333333333333_address};
+
+namespace
+{
+    Block make_block(std::vector<Address> const &to)
+    {
+        Block block{};
+        for (auto const &address : to) {
+            block.transactions.push_back(Transaction{.to = address});
+        }
+        return block;
+    }
+}
+
+TEST(ConflictPredictor, cold)
+{
+    ConflictPredictor predictor;
+    auto const block = make_block({a, a, a});
+    auto const predecessors = predictor.predict(block, {s1, s2, s3});
+    ASSERT_EQ(predecessors.size(), 3u);
+    for (auto const &predecessor : predecessors) {
+        EXPECT_FALSE(predecessor.has_value());
+    }
+}
+
+TEST(ConflictPredictor, hold_on_hot_contract)
+{
+    ConflictPredictor predictor;
+    {
+        // tx 1 called `a` and retried on a slot of `c`
+        auto const block = make_block({b, a});
+        BlockMetrics metrics;
+        metrics.record_conflict(1, c);
+        predictor.update(block, metrics);
+    }
+    EXPECT_TRUE(predictor.is_hot(a));
+    EXPECT_FALSE(predictor.is_hot(b));
+    EXPECT_TRUE(predictor.is_hot(c));
+
+    auto const block = make_block({a, b, a, c});
+    auto const predecessors = predictor.predict(block, {s1, s2, s3, s1});
+    ASSERT_EQ(predecessors.size(), 4u);
+    EXPECT_FALSE(predecessors[0].has_value());
+    EXPECT_FALSE(predecessors[1].has_value());
+    EXPECT_EQ(predecessors[2], 0u);
+    EXPECT_FALSE(predecessors[3].has_value());
+}
+
+TEST(ConflictPredictor, access_list)
+{
+    ConflictPredictor predictor;
+    {
+        auto const block = make_block({c});
+        BlockMetrics metrics;
+        metrics.record_conflict(0, c);
+        predictor.update(block, metrics);
+    }
+
+    auto block = make_block({c, b, a});
+    block.transactions[2].access_list.push_back({c, {}});
+    auto const predecessors = predictor.predict(block, {s1, s2, s3});
+    EXPECT_FALSE(predecessors[0].has_value());
+    EXPECT_FALSE(predecessors[1].has_value());
+    EXPECT_EQ(predecessors[2], 0u);
+}
+
+TEST(ConflictPredictor, decay)
+{
+    ConflictPredictor predictor;
+    {
+        auto const block = make_block({a});
+        BlockMetrics metrics;
+        metrics.record_conflict(0, a);
+        predictor.update(block, metrics);
+    }
+    EXPECT_TRUE(predictor.is_hot(a));
+
+    BlockMetrics const quiet;
+    for (unsigned i = 0; i < 3; ++i) {
+        predictor.update(Block{}, quiet);
+    }
+    EXPECT_FALSE(predictor.is_hot(a));
+    EXPECT_EQ(predictor.size(), 1u);
+
+    for (unsigned i = 0; i < 8; ++i) {
+        predictor.update(Block{}, quiet);
+    }
+    EXPECT_EQ(predictor.size(), 0u);
+}
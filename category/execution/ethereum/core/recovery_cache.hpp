@@ -0,0 +1,85 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#pragma once
+
+#include <category/core/bytes.hpp>
+#include <category/core/bytes_hash_compare.hpp>
+#include <category/core/config.hpp>
+#include <category/core/lru/clock_cache.hpp>
+#include <category/execution/ethereum/core/address.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+MONAD_NAMESPACE_BEGIN
+
+// Bounded cache of the addresses recovered from secp256k1 signatures, shared
+// by all the recoveries of a process. Proposals of the same transactions,
+// e.g. on forks or re-proposals after a timeout, recover each signature
+// once. The key is the hash of the signed message and of the signature, so
+// a transaction and an authorization tuple signed alike share an entry.
+class RecoveryCache final
+{
+    using Cache = ClockCache<
+        bytes32_t, std::optional<Address>, BytesHashCompare<bytes32_t>>;
+
+    Cache cache_;
+    std::atomic<uint64_t> n_hits_{0};
+    std::atomic<uint64_t> n_misses_{0};
+
+public:
+    static constexpr size_t DEFAULT_SIZE = 1'000'000;
+
+    explicit RecoveryCache(size_t const max_size = DEFAULT_SIZE)
+        : cache_{max_size}
+    {
+    }
+
+    // if `n_hits` is not null, a hit is also counted there, for callers
+    // that account for their own recoveries
+    template <class Recover>
+    std::optional<Address> find_or_recover(
+        bytes32_t const &key, Recover &&recover, uint64_t *const n_hits)
+    {
+        {
+            Cache::ConstAccessor it{};
+            if (cache_.find(it, key)) {
+                n_hits_.fetch_add(1, std::memory_order_relaxed);
+                if (n_hits != nullptr) {
+                    ++*n_hits;
+                }
+                return it->second.value_;
+            }
+        }
+        n_misses_.fetch_add(1, std::memory_order_relaxed);
+        std::optional<Address> const address = recover();
+        cache_.insert(key, address);
+        return address;
+    }
+
+    uint64_t num_hits() const
+    {
+        return n_hits_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t num_misses() const
+    {
+        return n_misses_.load(std::memory_order_relaxed);
+    }
+};
+
+MONAD_NAMESPACE_END
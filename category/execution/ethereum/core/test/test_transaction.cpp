@@ -14,6 +14,7 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <category/execution/ethereum/core/block.hpp>
+#include <category/execution/ethereum/core/recovery_cache.hpp>
 #include <category/execution/ethereum/core/transaction.hpp>
 #include <category/execution/ethereum/db/block_db.hpp>
 
@@ -79,3 +80,34 @@ TEST(TransactionProcessor, recover_sender_block_14000000)
     EXPECT_EQ(
         sender3.value(), 0x8Ce36461B8aC28B0eaF1d2466e05ED4fa4DE3B9e_address);
 }
+
+TEST(Transaction, recover_sender_cached)
+{
+    Block block{};
+    BlockDb const block_db(test_resource::correct_block_data_dir);
+    bool const res = block_db.get(2'730'000u, block);
+    ASSERT_TRUE(res);
+
+    RecoveryCache cache{16};
+    for (auto const &transaction : block.transactions) {
+        EXPECT_EQ(
+            recover_sender(transaction, &cache), recover_sender(transaction));
+    }
+    EXPECT_EQ(cache.num_hits(), 0u);
+    EXPECT_EQ(cache.num_misses(), 4u);
+
+    uint64_t n_hits = 0;
+    auto const sender0 =
+        recover_sender(block.transactions[0], &cache, &n_hits);
+    EXPECT_EQ(
+        sender0.value(), 0x2a65Aca4D5fC5B5C859090a6c34d164135398226_address);
+    EXPECT_EQ(cache.num_hits(), 1u);
+    EXPECT_EQ(n_hits, 1u);
+
+    // same message, other signature
+    auto transaction = block.transactions[0];
+    transaction.sc.s -= 1;
+    EXPECT_NE(recover_sender(transaction, &cache, &n_hits), sender0);
+    EXPECT_EQ(cache.num_misses(), 5u);
+    EXPECT_EQ(n_hits, 1u);
+}
@@ -14,9 +14,11 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <category/core/byte_string.hpp>
+#include <category/core/bytes.hpp>
 #include <category/core/config.hpp>
 #include <category/core/keccak.hpp>
 #include <category/execution/ethereum/core/address.hpp>
+#include <category/execution/ethereum/core/recovery_cache.hpp>
 #include <category/execution/ethereum/core/rlp/transaction_rlp.hpp>
 #include <category/execution/ethereum/core/transaction.hpp>
 #include <category/execution/ethereum/trace/event_trace.hpp>
@@ -30,13 +32,15 @@
 #include <secp256k1.h>
 
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <optional>
 
 MONAD_ANONYMOUS_NAMESPACE_BEGIN
 
-std::optional<Address>
-ecrecover(SignatureAndChain const &sc, byte_string_view encoding)
+std::optional<Address> ecrecover(
+    SignatureAndChain const &sc, byte_string_view encoding,
+    RecoveryCache *const cache, uint64_t *const n_hits)
 {
     if (sc.y_parity > 1) {
         return std::nullopt;
@@ -48,43 +52,61 @@ ecrecover(SignatureAndChain const &sc, byte_string_view encoding)
     intx::be::unsafe::store(signature, sc.r);
     intx::be::unsafe::store(signature + sizeof(sc.r), sc.s);
 
-    thread_local std::unique_ptr<
-        secp256k1_context,
-        decltype(&secp256k1_context_destroy)> const
-        context(
-            secp256k1_context_create(SILKPRE_SECP256K1_CONTEXT_FLAGS),
-            &secp256k1_context_destroy);
-
-    Address result;
-
-    if (!silkpre_recover_address(
-            result.bytes,
-            encoding_hash.bytes,
-            signature,
-            sc.y_parity,
-            context.get())) {
-        return std::nullopt;
+    auto const recover = [&]() -> std::optional<Address> {
+        thread_local std::unique_ptr<
+            secp256k1_context,
+            decltype(&secp256k1_context_destroy)> const
+            context(
+                secp256k1_context_create(SILKPRE_SECP256K1_CONTEXT_FLAGS),
+                &secp256k1_context_destroy);
+
+        Address result;
+
+        if (!silkpre_recover_address(
+                result.bytes,
+                encoding_hash.bytes,
+                signature,
+                sc.y_parity,
+                context.get())) {
+            return std::nullopt;
+        }
+
+        return result;
+    };
+
+    if (cache == nullptr) {
+        return recover();
     }
 
-    return result;
+    // the address only depends on the signed message and the signature
+    uint8_t key[sizeof(encoding_hash.bytes) + sizeof(signature) + 1];
+    std::memcpy(key, encoding_hash.bytes, sizeof(encoding_hash.bytes));
+    std::memcpy(
+        key + sizeof(encoding_hash.bytes), signature, sizeof(signature));
+    key[sizeof(key) - 1] = sc.y_parity;
+    return cache->find_or_recover(
+        to_bytes(keccak256(key)), recover, n_hits);
 }
 
 MONAD_ANONYMOUS_NAMESPACE_END
 
 MONAD_NAMESPACE_BEGIN
 
-std::optional<Address> recover_authority(AuthorizationEntry const &auth_entry)
+std::optional<Address> recover_authority(
+    AuthorizationEntry const &auth_entry, RecoveryCache *const cache,
+    uint64_t *const n_hits)
 {
     byte_string const auth_encoding =
         rlp::encode_authorization_entry_for_signing(auth_entry);
-    return ecrecover(auth_entry.sc, auth_encoding);
+    return ecrecover(auth_entry.sc, auth_encoding, cache, n_hits);
 }
 
-std::optional<Address> recover_sender(Transaction const &tx)
+std::optional<Address> recover_sender(
+    Transaction const &tx, RecoveryCache *const cache, uint64_t *const n_hits)
 {
     TRACE_TXN_EVENT(StartSenderRecovery);
     byte_string const tx_encoding = rlp::encode_transaction_for_signing(tx);
-    return ecrecover(tx.sc, tx_encoding);
+    return ecrecover(tx.sc, tx_encoding, cache, n_hits);
 }
 
 MONAD_NAMESPACE_END
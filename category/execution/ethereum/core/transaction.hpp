@@ -30,6 +30,8 @@
 
 MONAD_NAMESPACE_BEGIN
 
+class RecoveryCache;
+
 enum class TransactionType : char
 {
     legacy = 0,
@@ -69,7 +71,9 @@ struct AuthorizationEntry
 static_assert(sizeof(AuthorizationEntry) == 144);
 static_assert(alignof(AuthorizationEntry) == 8);
 
-std::optional<Address> recover_authority(AuthorizationEntry const &);
+std::optional<Address> recover_authority(
+    AuthorizationEntry const &, RecoveryCache * = nullptr,
+    uint64_t *n_hits = nullptr);
 
 using AuthorizationList = std::vector<AuthorizationEntry>;
 
@@ -98,6 +102,7 @@ struct Transaction
 static_assert(sizeof(Transaction) == 384);
 static_assert(alignof(Transaction) == 8);
 
-std::optional<Address> recover_sender(Transaction const &);
+std::optional<Address> recover_sender(
+    Transaction const &, RecoveryCache * = nullptr, uint64_t *n_hits = nullptr);
 
 MONAD_NAMESPACE_END
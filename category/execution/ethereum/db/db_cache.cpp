@@ -0,0 +1,259 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/core/bytes.hpp>
+#include <category/core/config.hpp>
+#include <category/core/fiber/priority_pool.hpp>
+#include <category/execution/ethereum/core/account.hpp>
+#include <category/execution/ethereum/core/address.hpp>
+#include <category/execution/ethereum/db/db_cache.hpp>
+#include <category/vm/vm.hpp>
+
+#include <boost/fiber/future/future.hpp>
+#include <boost/fiber/future/promise.hpp>
+
+#include <quill/Quill.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <ios>
+#include <memory>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+MONAD_NAMESPACE_BEGIN
+
+namespace
+{
+    constexpr uint64_t HOT_SET_MAGIC = 0x3154'4553'544f'4800; // "\0HOTSET1"
+
+    // keys read by one fiber
+    constexpr size_t HOT_SET_CHUNK = 64;
+
+    struct HotSetHeader
+    {
+        uint64_t magic;
+        uint64_t n_accounts;
+        uint64_t n_slots;
+    };
+
+    // distinguishes the temporary files of the writes of a process
+    std::atomic<uint64_t> hot_set_writes{0};
+}
+
+void DbCache::save_hot_set(std::filesystem::path const &path)
+{
+    if (hot_set_writer_.valid()) {
+        hot_set_writer_.wait();
+    }
+    write_hot_set(path, collect_hot_set());
+}
+
+void DbCache::set_hot_set_autosave(
+    std::filesystem::path const &path, uint64_t const interval)
+{
+    hot_set_path_ = path;
+    hot_set_interval_ = interval;
+}
+
+std::optional<DbCache::HotSetStats> DbCache::warm_up(
+    std::filesystem::path const &path, fiber::PriorityPool &pool,
+    vm::VM &vm)
+{
+    auto const begin = std::chrono::steady_clock::now();
+    std::optional<HotSet> const hot_set = read_hot_set(path);
+    if (!hot_set.has_value()) {
+        return std::nullopt;
+    }
+
+    std::atomic<uint64_t> n_code{0};
+    std::vector<boost::fibers::future<void>> pending;
+    auto const submit = [&](size_t const n, auto const &read) {
+        for (size_t i = 0; i < n; i += HOT_SET_CHUNK) {
+            auto const promise =
+                std::make_shared<boost::fibers::promise<void>>();
+            pending.push_back(promise->get_future());
+            pool.submit(
+                0,
+                [&read, i, end = std::min(i + HOT_SET_CHUNK, n), promise] {
+                    for (size_t j = i; j < end; ++j) {
+                        read(j);
+                    }
+                    promise->set_value();
+                });
+        }
+    };
+    auto const read_account = [&](size_t const i) {
+        Address const &address = hot_set->accounts[i];
+        std::optional<Account> const account = db_.read_account(address);
+        accounts_.insert(address, account);
+        if (account.has_value() && account->code_hash != NULL_HASH &&
+            !vm.find_varcode(account->code_hash).has_value()) {
+            vm.try_insert_varcode(
+                account->code_hash, db_.read_code(account->code_hash));
+            n_code.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+    auto const read_slot = [&](size_t const i) {
+        StorageKey const &skey = hot_set->slots[i];
+        Address address;
+        Incarnation incarnation{0, 0};
+        bytes32_t key;
+        std::memcpy(address.bytes, skey.bytes, sizeof(Address));
+        std::memcpy(
+            &incarnation, &skey.bytes[sizeof(Address)], sizeof(Incarnation));
+        std::memcpy(
+            key.bytes,
+            &skey.bytes[sizeof(Address) + sizeof(Incarnation)],
+            sizeof(bytes32_t));
+        storage_.insert(skey, db_.read_storage(address, incarnation, key));
+    };
+    submit(hot_set->accounts.size(), read_account);
+    submit(hot_set->slots.size(), read_slot);
+
+    size_t const step = std::max(pending.size() / 10, size_t{1});
+    for (size_t i = 0; i < pending.size(); ++i) {
+        pending[i].get();
+        if ((i + 1) % step == 0 && i + 1 < pending.size()) {
+            LOG_INFO(
+                "Warming up state caches: {}%", (i + 1) * 100 / pending.size());
+        }
+    }
+
+    HotSetStats const stats{
+        .accounts = hot_set->accounts.size(),
+        .slots = hot_set->slots.size(),
+        .code = n_code.load(std::memory_order_relaxed)};
+    LOG_INFO(
+        "Warmed up state caches with {} accounts, {} slots and {} code from "
+        "{} in {} ms",
+        stats.accounts,
+        stats.slots,
+        stats.code,
+        path.string(),
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - begin)
+            .count());
+    return stats;
+}
+
+DbCache::HotSet DbCache::collect_hot_set()
+{
+    return {
+        .accounts = accounts_.keys(MAX_HOT_ACCOUNTS),
+        .slots = storage_.keys(MAX_HOT_SLOTS)};
+}
+
+void DbCache::save_hot_set_async()
+{
+    // at most one write in flight
+    if (hot_set_writer_.valid()) {
+        hot_set_writer_.wait();
+    }
+    hot_set_writer_ = std::async(
+        std::launch::async,
+        [path = hot_set_path_, hot_set = collect_hot_set()] {
+            write_hot_set(path, hot_set);
+        });
+}
+
+void DbCache::write_hot_set(
+    std::filesystem::path const &path, HotSet const &hot_set)
+{
+    // written aside and renamed, a crash never leaves a partial hot set
+    std::filesystem::path tmp = path;
+    tmp += ".tmp." + std::to_string(
+                         hot_set_writes.fetch_add(1, std::memory_order_relaxed));
+    {
+        std::ofstream out{tmp, std::ios::out | std::ios::binary};
+        if (!out) {
+            LOG_WARNING("Could not write hot set to {}", tmp.string());
+            return;
+        }
+        HotSetHeader const header{
+            .magic = HOT_SET_MAGIC,
+            .n_accounts = hot_set.accounts.size(),
+            .n_slots = hot_set.slots.size()};
+        out.write(reinterpret_cast<char const *>(&header), sizeof(header));
+        out.write(
+            reinterpret_cast<char const *>(hot_set.accounts.data()),
+            static_cast<std::streamsize>(
+                hot_set.accounts.size() * sizeof(Address)));
+        out.write(
+            reinterpret_cast<char const *>(hot_set.slots.data()),
+            static_cast<std::streamsize>(
+                hot_set.slots.size() * sizeof(StorageKey)));
+        if (!out.flush()) {
+            LOG_WARNING("Could not write hot set to {}", tmp.string());
+            out.close();
+            std::error_code ec;
+            std::filesystem::remove(tmp, ec);
+            return;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp, path, ec);
+    if (ec) {
+        LOG_WARNING(
+            "Could not rename {} to {}: {}",
+            tmp.string(),
+            path.string(),
+            ec.message());
+        std::filesystem::remove(tmp, ec);
+    }
+}
+
+std::optional<DbCache::HotSet>
+DbCache::read_hot_set(std::filesystem::path const &path)
+{
+    std::ifstream in{path, std::ios::in | std::ios::binary};
+    if (!in) {
+        return std::nullopt;
+    }
+    HotSetHeader header;
+    in.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!in || header.magic != HOT_SET_MAGIC ||
+        header.n_accounts > MAX_HOT_ACCOUNTS ||
+        header.n_slots > MAX_HOT_SLOTS) {
+        LOG_WARNING("Ignoring invalid hot set {}", path.string());
+        return std::nullopt;
+    }
+    HotSet hot_set{
+        .accounts = std::vector<Address>(header.n_accounts),
+        .slots = std::vector<StorageKey>(header.n_slots)};
+    in.read(
+        reinterpret_cast<char *>(hot_set.accounts.data()),
+        static_cast<std::streamsize>(header.n_accounts * sizeof(Address)));
+    in.read(
+        reinterpret_cast<char *>(hot_set.slots.data()),
+        static_cast<std::streamsize>(header.n_slots * sizeof(StorageKey)));
+    if (!in || in.peek() != std::ifstream::traits_type::eof()) {
+        LOG_WARNING("Ignoring invalid hot set {}", path.string());
+        return std::nullopt;
+    }
+    return hot_set;
+}
+
+MONAD_NAMESPACE_END
@@ -18,7 +18,8 @@
 #include <category/core/bytes.hpp>
 #include <category/core/bytes_hash_compare.hpp>
 #include <category/core/config.hpp>
-#include <category/core/lru/lru_cache.hpp>
+#include <category/core/fiber/priority_pool.hpp>
+#include <category/core/lru/clock_cache.hpp>
 #include <category/execution/ethereum/core/account.hpp>
 #include <category/execution/ethereum/core/address.hpp>
 #include <category/execution/ethereum/db/db.hpp>
@@ -29,8 +30,14 @@
 
 #include <evmc/evmc.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <future>
 #include <memory>
 #include <optional>
+#include <vector>
 
 MONAD_NAMESPACE_BEGIN
 
@@ -62,16 +69,61 @@ class DbCache final : public Db
     using AddressHashCompare = BytesHashCompare<Address>;
     using StorageKeyHashCompare = BytesHashCompare<StorageKey>;
     using AccountsCache =
-        LruCache<Address, std::optional<Account>, AddressHashCompare>;
-    using StorageCache = LruCache<StorageKey, bytes32_t, StorageKeyHashCompare>;
+        ClockCache<Address, std::optional<Account>, AddressHashCompare>;
+    using StorageCache =
+        ClockCache<StorageKey, bytes32_t, StorageKeyHashCompare>;
 
-    AccountsCache accounts_{10'000'000};
-    StorageCache storage_{10'000'000};
+    // CACHE BUDGET
+    // each cache gets at least 1 / MIN_SHARE of the budget, and moves by
+    // 1 / BUDGET_STEPS of it at a time
+    static constexpr size_t MIN_SHARE = 16;
+    static constexpr size_t BUDGET_STEPS = 64;
+    static constexpr uint64_t MIN_GHOST_HITS = 64;
+    static constexpr double GAIN_RATIO = 1.25;
+
+    size_t budget_;
+    size_t account_bytes_;
+    uint64_t account_ghost_hits_{0};
+    uint64_t storage_ghost_hits_{0};
+    AccountsCache accounts_;
+    StorageCache storage_;
     Proposals proposals_;
+    std::filesystem::path hot_set_path_{};
+    uint64_t hot_set_interval_{0};
+    uint64_t n_finalized_{0};
+    std::future<void> hot_set_writer_{};
 
 public:
-    DbCache(Db &db)
+    static constexpr size_t DEFAULT_BUDGET = size_t{4} << 30;
+
+    // HOT SET
+    // The keys of the account and storage caches, most recently referenced
+    // first, saved to a file so that a restarted node can read them back
+    // into the caches before it executes its first block. The reads go
+    // through the database, which also warms its node cache, and the code
+    // of the accounts read is inserted in the varcode cache of the vm.
+    static constexpr size_t MAX_HOT_ACCOUNTS = 1'000'000;
+    static constexpr size_t MAX_HOT_SLOTS = 2'000'000;
+
+    struct HotSetStats
+    {
+        uint64_t accounts;
+        uint64_t slots;
+        uint64_t code;
+    };
+
+    // `budget` is the memory in bytes shared by the account and storage
+    // caches
+    DbCache(Db &db, size_t const budget = DEFAULT_BUDGET)
         : db_{db}
+        , budget_{budget}
+        , account_bytes_{budget / 2}
+        , accounts_{
+              account_bytes_ / AccountsCache::entry_bytes(),
+              max_bytes(budget) / AccountsCache::entry_bytes()}
+        , storage_{
+              (budget - account_bytes_) / StorageCache::entry_bytes(),
+              max_bytes(budget) / StorageCache::entry_bytes()}
     {
     }
 
@@ -130,7 +182,8 @@ public:
         std::unique_ptr<ProposalState> const ps =
             proposals_.finalize(block_number, block_id);
         if (ps) {
-            insert_in_lru_caches(ps->state());
+            insert_in_lru_caches(*ps);
+            rebalance();
         }
         else {
             // Finalizing a truncated proposal. Clear LRU caches.
@@ -138,6 +191,9 @@ public:
             storage_.clear();
         }
         db_.finalize(block_number, block_id);
+        if (hot_set_interval_ && ++n_finalized_ % hot_set_interval_ == 0) {
+            save_hot_set_async();
+        }
     }
 
     virtual void update_verified_block(uint64_t const block_number) override
@@ -212,30 +268,101 @@ public:
         return db_.withdrawals_root();
     }
 
+    // bytes of the budget given to the account cache, the storage cache gets
+    // the rest
+    size_t account_budget() const
+    {
+        return account_bytes_;
+    }
+
     virtual std::string print_stats() override
     {
         return db_.print_stats() + ",ac=" + accounts_.print_stats() +
                ",sc=" + storage_.print_stats();
     }
 
+    // not thread safe with finalize. Waits for a background save, if any,
+    // first
+    void save_hot_set(std::filesystem::path const &);
+
+    // also saves the hot set in the background every `interval` finalized
+    // blocks
+    void
+    set_hot_set_autosave(std::filesystem::path const &, uint64_t interval);
+
+    // reads the keys of a saved hot set at the current block, before any
+    // proposal is committed. Returns nothing if there is no valid hot set
+    // at `path`.
+    std::optional<HotSetStats> warm_up(
+        std::filesystem::path const &, fiber::PriorityPool &, vm::VM &);
+
 private:
-    void insert_in_lru_caches(StateDeltas const &state_deltas)
-    {
-        for (auto it = state_deltas.cbegin(); it != state_deltas.cend(); ++it) {
-            auto const &address = it->first;
-            auto const &account_delta = it->second.account;
-            accounts_.insert(address, account_delta.second);
-            auto const &storage = it->second.storage;
-            auto const &account = account_delta.second;
-            if (account.has_value()) {
-                for (auto it2 = storage.cbegin(); it2 != storage.cend();
-                     ++it2) {
-                    auto const &key = it2->first;
-                    auto const &storage_delta = it2->second;
-                    auto const incarnation = account->incarnation;
+    struct HotSet
+    {
+        std::vector<Address> accounts;
+        std::vector<StorageKey> slots;
+    };
+
+    HotSet collect_hot_set();
+    void save_hot_set_async();
+    static void write_hot_set(std::filesystem::path const &, HotSet const &);
+    static std::optional<HotSet> read_hot_set(std::filesystem::path const &);
+
+    static size_t max_bytes(size_t const budget)
+    {
+        return budget - budget / MIN_SHARE;
+    }
+
+    // CACHE BUDGET
+    // A ghost hit is a miss that a cache larger by its ghost size would
+    // have hit. Moves a step of the budget toward the cache with more ghost
+    // hits per byte, i.e. with the higher marginal hit rate.
+    void rebalance()
+    {
+        uint64_t const account_ghost_hits = accounts_.stats().ghost_hits;
+        uint64_t const storage_ghost_hits = storage_.stats().ghost_hits;
+        uint64_t const n_accounts = account_ghost_hits - account_ghost_hits_;
+        uint64_t const n_storage = storage_ghost_hits - storage_ghost_hits_;
+        if (n_accounts + n_storage < MIN_GHOST_HITS) {
+            return;
+        }
+        account_ghost_hits_ = account_ghost_hits;
+        storage_ghost_hits_ = storage_ghost_hits;
+
+        double const account_gain =
+            static_cast<double>(n_accounts) /
+            static_cast<double>(
+                accounts_.ghost_size() * AccountsCache::entry_bytes());
+        double const storage_gain =
+            static_cast<double>(n_storage) /
+            static_cast<double>(
+                storage_.ghost_size() * StorageCache::entry_bytes());
+        size_t const step = budget_ / BUDGET_STEPS;
+        size_t const min_bytes = budget_ - max_bytes(budget_);
+        if (account_gain > GAIN_RATIO * storage_gain) {
+            account_bytes_ =
+                std::min(account_bytes_ + step, max_bytes(budget_));
+        }
+        else if (storage_gain > GAIN_RATIO * account_gain) {
+            account_bytes_ -= std::min(step, account_bytes_ - min_bytes);
+        }
+        else {
+            return;
+        }
+        accounts_.set_max_size(account_bytes_ / AccountsCache::entry_bytes());
+        storage_.set_max_size(
+            (budget_ - account_bytes_) / StorageCache::entry_bytes());
+    }
+
+    void insert_in_lru_caches(ProposalState const &ps)
+    {
+        for (auto const &frozen : ps.accounts()) {
+            accounts_.insert(frozen.address, frozen.account);
+            if (frozen.account.has_value()) {
+                auto const incarnation = frozen.account->incarnation;
+                for (auto const &[key, value] : ps.storage(frozen)) {
                     storage_.insert(
-                        StorageKey(address, incarnation, key),
-                        storage_delta.second);
+                        StorageKey(frozen.address, incarnation, key), value);
                 }
             }
         }
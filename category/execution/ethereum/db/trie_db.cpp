@@ -41,9 +41,11 @@
 #include <category/execution/ethereum/types/incarnation.hpp>
 #include <category/execution/ethereum/validate_block.hpp>
 #include <category/mpt/db.hpp>
+#include <category/mpt/db_error.hpp>
 #include <category/mpt/nibbles_view.hpp>
 #include <category/mpt/nibbles_view_fmt.hpp> // NOLINT
 #include <category/mpt/node.hpp>
+#include <category/mpt/node_cursor.hpp>
 #include <category/mpt/traverse.hpp>
 #include <category/mpt/update.hpp>
 #include <category/mpt/util.hpp>
@@ -59,6 +61,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
@@ -103,14 +106,32 @@ TrieDb::TrieDb(mpt::Db &db)
 
 TrieDb::~TrieDb() = default;
 
+Result<byte_string_view>
+TrieDb::get(NibblesView const key, mpt::OwningNodeCursor &owner) const
+{
+    if (db_.num_read_threads() == 0) {
+        return db_.get(key, block_number_);
+    }
+    auto res = db_.find_owning(key, block_number_);
+    if (!res.has_value()) {
+        return mpt::DbError(res.error().value());
+    }
+    owner = std::move(res.value());
+    if (!owner.node->has_value()) {
+        return mpt::DbError::key_not_found;
+    }
+    return owner.node->value();
+}
+
 std::optional<Account> TrieDb::read_account(Address const &addr)
 {
-    auto const value = db_.get(
+    mpt::OwningNodeCursor owner;
+    auto const value = get(
         concat(
             prefix_,
             STATE_NIBBLE,
             NibblesView{keccak256({addr.bytes, sizeof(addr.bytes)})}),
-        block_number_);
+        owner);
     if (!value.has_value()) {
         stats_account_no_value();
         return std::nullopt;
@@ -126,13 +147,14 @@ std::optional<Account> TrieDb::read_account(Address const &addr)
 bytes32_t
 TrieDb::read_storage(Address const &addr, Incarnation, bytes32_t const &key)
 {
-    auto const value = db_.get(
+    mpt::OwningNodeCursor owner;
+    auto const value = get(
         concat(
             prefix_,
             STATE_NIBBLE,
             NibblesView{keccak256({addr.bytes, sizeof(addr.bytes)})},
             NibblesView{keccak256({key.bytes, sizeof(key.bytes)})}),
-        block_number_);
+        owner);
     if (!value.has_value()) {
         stats_storage_no_value();
         return {};
@@ -147,12 +169,13 @@ TrieDb::read_storage(Address const &addr, Incarnation, bytes32_t const &key)
 vm::SharedIntercode TrieDb::read_code(bytes32_t const &code_hash)
 {
     // TODO read intercode object
-    auto const value = db_.get(
+    mpt::OwningNodeCursor owner;
+    auto const value = get(
         concat(
             prefix_,
             CODE_NIBBLE,
             NibblesView{to_byte_string_view(code_hash.bytes)}),
-        block_number_);
+        owner);
     if (!value.has_value()) {
         return vm::make_shared_intercode({});
     }
@@ -197,8 +220,30 @@ void TrieDb::commit(
         prefix_ = dest_prefix;
     }
 
+    // the keys of the updates are hashed several at a time, in the order
+    // they are consumed below
+    std::vector<byte_string_view> account_keys;
+    std::vector<byte_string_view> storage_keys;
+    for (auto const &[addr, delta] : state_deltas) {
+        account_keys.emplace_back(addr.bytes, sizeof(addr.bytes));
+        if (delta.account.second.has_value()) {
+            for (auto const &[key, delta] : delta.storage) {
+                if (delta.first != delta.second) {
+                    storage_keys.emplace_back(key.bytes, sizeof(key.bytes));
+                }
+            }
+        }
+    }
+    std::vector<hash256> account_hashes(account_keys.size());
+    std::vector<hash256> storage_hashes(storage_keys.size());
+    keccak256(account_keys, account_hashes);
+    keccak256(storage_keys, storage_hashes);
+    size_t next_account = 0;
+    size_t next_storage = 0;
+
     UpdateList account_updates;
     for (auto const &[addr, delta] : state_deltas) {
+        hash256 const &account_hash = account_hashes[next_account++];
         UpdateList storage_updates;
         std::optional<byte_string_view> value;
         auto const &account = delta.account.second;
@@ -208,7 +253,7 @@ void TrieDb::commit(
                     storage_updates.push_front(
                         update_alloc_.emplace_back(Update{
                             .key = hash_alloc_.emplace_back(
-                                keccak256({key.bytes, sizeof(key.bytes)})),
+                                storage_hashes[next_storage++]),
                             .value = delta.second == bytes32_t{}
                                          ? std::nullopt
                                          : std::make_optional<byte_string_view>(
@@ -229,14 +274,14 @@ void TrieDb::commit(
                 account.has_value() && delta.account.first.has_value() &&
                 delta.account.first->incarnation != account->incarnation;
             account_updates.push_front(update_alloc_.emplace_back(Update{
-                .key = hash_alloc_.emplace_back(
-                    keccak256({addr.bytes, sizeof(addr.bytes)})),
+                .key = hash_alloc_.emplace_back(account_hash),
                 .value = value,
                 .incarnation = incarnation,
                 .next = std::move(storage_updates),
                 .version = static_cast<int64_t>(block_number_)}));
         }
     }
+    MONAD_ASSERT(next_storage == storage_hashes.size());
 
     UpdateList code_updates;
     for (auto const &[hash, icode] : code) {
@@ -18,6 +18,7 @@
 #include <category/core/bytes.hpp>
 #include <category/core/config.hpp>
 #include <category/core/keccak.hpp>
+#include <category/core/result.hpp>
 #include <category/execution/ethereum/core/block.hpp>
 #include <category/execution/ethereum/core/receipt.hpp>
 #include <category/execution/ethereum/core/transaction.hpp>
@@ -117,6 +118,11 @@ private:
     }
 
     bytes32_t merkle_root(mpt::Nibbles const &);
+
+    // the value at `key` of the current block, read on a reader thread of
+    // the db when it has them. `owner` keeps a value read that way alive.
+    Result<byte_string_view>
+    get(mpt::NibblesView key, mpt::OwningNodeCursor &owner) const;
 };
 
 MONAD_NAMESPACE_END
@@ -473,20 +473,24 @@ constexpr uint8_t MachineBase::prefix_len() const
 
 mpt::Compute &MachineBase::get_compute() const
 {
-    static EmptyCompute empty_compute;
-
-    static AccountMerkleCompute account_compute;
-    static AccountRootMerkleCompute account_root_compute;
-    static StorageMerkleCompute storage_compute;
-    static StorageRootMerkleCompute storage_root_compute;
-
-    static VarLenMerkleCompute generic_merkle_compute;
-    static RootVarLenMerkleCompute generic_root_merkle_compute;
-
-    static VarLenMerkleCompute<ReceiptLeafProcessor> receipt_compute;
-    static RootVarLenMerkleCompute<ReceiptLeafProcessor> receipt_root_compute;
-    static VarLenMerkleCompute<TransactionLeafProcess> transaction_compute;
-    static RootVarLenMerkleCompute<TransactionLeafProcess>
+    // computes keep state between calls, and also run on the hashing
+    // threads of the trie
+    thread_local EmptyCompute empty_compute;
+
+    thread_local AccountMerkleCompute account_compute;
+    thread_local AccountRootMerkleCompute account_root_compute;
+    thread_local StorageMerkleCompute storage_compute;
+    thread_local StorageRootMerkleCompute storage_root_compute;
+
+    thread_local VarLenMerkleCompute generic_merkle_compute;
+    thread_local RootVarLenMerkleCompute generic_root_merkle_compute;
+
+    thread_local VarLenMerkleCompute<ReceiptLeafProcessor> receipt_compute;
+    thread_local RootVarLenMerkleCompute<ReceiptLeafProcessor>
+        receipt_root_compute;
+    thread_local VarLenMerkleCompute<TransactionLeafProcess>
+        transaction_compute;
+    thread_local RootVarLenMerkleCompute<TransactionLeafProcess>
         transaction_root_compute;
 
     auto const prefix_length = prefix_len();
@@ -28,6 +28,7 @@
 #include <category/execution/ethereum/core/block.hpp>
 #include <category/execution/ethereum/core/fmt/transaction_fmt.hpp>
 #include <category/execution/ethereum/core/receipt.hpp>
+#include <category/execution/ethereum/core/recovery_cache.hpp>
 #include <category/execution/ethereum/core/transaction.hpp>
 #include <category/execution/ethereum/core/withdrawal.hpp>
 #include <category/execution/ethereum/dao.hpp>
@@ -47,11 +48,13 @@
 #include <category/vm/evm/switch_traits.hpp>
 #include <category/vm/evm/traits.hpp>
 
+#include <boost/fiber/future/future.hpp>
 #include <boost/fiber/future/promise.hpp>
 #include <boost/outcome/try.hpp>
 #include <evmc/evmc.h>
 #include <intx/intx.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
@@ -115,33 +118,78 @@ void set_beacon_root(BlockState &block_state, BlockHeader const &header)
     }
 }
 
+// Splits the transactions into contiguous chunks, one recovery task each,
+// of about the same number of signatures. A chunk amortises the submission
+// and the fiber switch of a task, and keeps one thread on consecutive
+// transactions with a warm secp256k1 context. Chunks stay small enough to
+// spread a block over the whole pool. Returns the boundaries of the chunks.
+std::vector<size_t> recovery_chunks(
+    std::vector<Transaction> const &transactions, bool const senders,
+    bool const authorities)
+{
+    constexpr size_t MAX_CHUNK = 16;
+    constexpr size_t MIN_CHUNKS = 64;
+
+    auto const n_signatures = [=](Transaction const &transaction) {
+        return (senders ? size_t{1} : size_t{0}) +
+               (authorities ? transaction.authorization_list.size() : 0);
+    };
+
+    size_t total = 0;
+    for (auto const &transaction : transactions) {
+        total += n_signatures(transaction);
+    }
+    size_t const chunk = std::clamp(total / MIN_CHUNKS, size_t{1}, MAX_CHUNK);
+
+    std::vector<size_t> chunks{0};
+    size_t n = 0;
+    for (size_t i = 0; i < transactions.size(); ++i) {
+        n += n_signatures(transactions[i]);
+        if (n >= chunk) {
+            chunks.push_back(i + 1);
+            n = 0;
+        }
+    }
+    if (chunks.back() != transactions.size()) {
+        chunks.push_back(transactions.size());
+    }
+    return chunks;
+}
+
 MONAD_ANONYMOUS_NAMESPACE_END
 
 MONAD_NAMESPACE_BEGIN
 
 std::vector<std::optional<Address>> recover_senders(
     std::vector<Transaction> const &transactions,
-    fiber::PriorityPool &priority_pool)
+    fiber::PriorityPool &priority_pool, RecoveryCache *const cache)
 {
     std::vector<std::optional<Address>> senders{transactions.size()};
 
+    auto const chunks = recovery_chunks(transactions, true, false);
+    size_t const n_chunks = chunks.size() - 1;
     std::shared_ptr<boost::fibers::promise<void>[]> promises{
-        new boost::fibers::promise<void>[transactions.size()]};
+        new boost::fibers::promise<void>[n_chunks]};
 
-    for (unsigned i = 0; i < transactions.size(); ++i) {
+    for (size_t c = 0; c < n_chunks; ++c) {
         priority_pool.submit(
-            i,
-            [i = i,
+            chunks[c],
+            [c = c,
+             begin = chunks[c],
+             end = chunks[c + 1],
              promises = promises,
-             &sender = senders[i],
-             &transaction = transactions[i]] {
-                sender = recover_sender(transaction);
-                promises[i].set_value();
+             cache,
+             &senders,
+             &transactions] {
+                for (size_t i = begin; i < end; ++i) {
+                    senders[i] = recover_sender(transactions[i], cache);
+                }
+                promises[c].set_value();
             });
     }
 
-    for (unsigned i = 0; i < transactions.size(); ++i) {
-        promises[i].get_future().wait();
+    for (size_t c = 0; c < n_chunks; ++c) {
+        promises[c].get_future().wait();
     }
 
     return senders;
@@ -149,41 +197,143 @@ std::vector<std::optional<Address>> recover_senders(
 
 std::vector<std::vector<std::optional<Address>>> recover_authorities(
     std::vector<Transaction> const &transactions,
-    fiber::PriorityPool &priority_pool)
+    fiber::PriorityPool &priority_pool, RecoveryCache *const cache)
 {
     std::vector<std::vector<std::optional<Address>>> authorities{
         transactions.size()};
-    std::vector<std::shared_ptr<boost::fibers::promise<void>[]>> promises{
-        transactions.size()};
-
-    for (auto i = 0u; i < transactions.size(); ++i) {
+    for (size_t i = 0; i < transactions.size(); ++i) {
         authorities[i] = std::vector<std::optional<Address>>{
             transactions[i].authorization_list.size()};
-        promises[i] = std::shared_ptr<boost::fibers::promise<void>[]>{
-            new boost::fibers::promise<void>[authorities[i].size()]};
+    }
 
-        for (auto j = 0u; j < authorities[i].size(); ++j) {
-            priority_pool.submit(
-                i,
-                [j = j,
-                 auth_promises = promises[i],
-                 &auth = authorities[i][j],
-                 &auth_entry = transactions[i].authorization_list[j]]() {
-                    auth = recover_authority(auth_entry);
-                    auth_promises[j].set_value();
-                });
-        }
+    auto const chunks = recovery_chunks(transactions, false, true);
+    size_t const n_chunks = chunks.size() - 1;
+    std::shared_ptr<boost::fibers::promise<void>[]> promises{
+        new boost::fibers::promise<void>[n_chunks]};
+
+    for (size_t c = 0; c < n_chunks; ++c) {
+        priority_pool.submit(
+            chunks[c],
+            [c = c,
+             begin = chunks[c],
+             end = chunks[c + 1],
+             promises = promises,
+             cache,
+             &authorities,
+             &transactions] {
+                for (size_t i = begin; i < end; ++i) {
+                    auto const &authorization_list =
+                        transactions[i].authorization_list;
+                    for (size_t j = 0; j < authorization_list.size(); ++j) {
+                        authorities[i][j] =
+                            recover_authority(authorization_list[j], cache);
+                    }
+                }
+                promises[c].set_value();
+            });
     }
 
-    for (auto i = 0u; i < transactions.size(); ++i) {
-        for (auto j = 0u; j < transactions[i].authorization_list.size(); ++j) {
-            promises[i][j].get_future().wait();
-        }
+    for (size_t c = 0; c < n_chunks; ++c) {
+        promises[c].get_future().wait();
     }
 
     return authorities;
 }
 
+SenderRecovery::SenderRecovery(
+    std::vector<Transaction> const &transactions,
+    fiber::PriorityPool &priority_pool, RecoveryCache *const cache)
+    : senders_{transactions.size()}
+    , authorities_{transactions.size()}
+    , progress_{std::make_shared<Progress>()}
+    , begin_{std::chrono::steady_clock::now()}
+{
+    for (size_t i = 0; i < transactions.size(); ++i) {
+        authorities_[i] = std::vector<std::optional<Address>>{
+            transactions[i].authorization_list.size()};
+    }
+
+    auto const chunks = recovery_chunks(transactions, true, true);
+    size_t const n_chunks = chunks.size() - 1;
+    progress_->remaining.store(n_chunks, std::memory_order_relaxed);
+    progress_->end.store(
+        begin_.time_since_epoch().count(), std::memory_order_relaxed);
+    progress_->cache_hits.store(0, std::memory_order_relaxed);
+    pending_.reserve(n_chunks);
+
+    // the tasks refer to the elements, not to the vector, which may be moved
+    Transaction const *const txns = transactions.data();
+    for (size_t c = 0; c < n_chunks; ++c) {
+        auto const promise = std::make_shared<boost::fibers::promise<void>>();
+        pending_.push_back(promise->get_future());
+        priority_pool.submit(
+            chunks[c],
+            [this,
+             begin = chunks[c],
+             end = chunks[c + 1],
+             txns,
+             promise = promise,
+             progress = progress_,
+             cache] {
+                uint64_t n_hits = 0;
+                for (size_t i = begin; i < end; ++i) {
+                    senders_[i] = recover_sender(txns[i], cache, &n_hits);
+                    auto const &authorization_list =
+                        txns[i].authorization_list;
+                    for (size_t j = 0; j < authorization_list.size(); ++j) {
+                        authorities_[i][j] = recover_authority(
+                            authorization_list[j], cache, &n_hits);
+                    }
+                }
+                progress->cache_hits.fetch_add(
+                    n_hits, std::memory_order_relaxed);
+                if (progress->remaining.fetch_sub(
+                        1, std::memory_order_acq_rel) == 1) {
+                    progress->end.store(
+                        std::chrono::steady_clock::now()
+                            .time_since_epoch()
+                            .count(),
+                        std::memory_order_release);
+                }
+                promise->set_value();
+            });
+    }
+}
+
+SenderRecovery::~SenderRecovery()
+{
+    wait();
+}
+
+void SenderRecovery::wait()
+{
+    if (pending_.empty()) {
+        return;
+    }
+    auto const stall_begin = std::chrono::steady_clock::now();
+    for (auto &future : pending_) {
+        future.wait();
+    }
+    pending_.clear();
+    stall_time_ += std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - stall_begin);
+}
+
+std::chrono::microseconds SenderRecovery::recovery_time()
+{
+    wait();
+    std::chrono::steady_clock::time_point const end{
+        std::chrono::steady_clock::duration{
+            progress_->end.load(std::memory_order_acquire)}};
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - begin_);
+}
+
+uint64_t SenderRecovery::num_cache_hits()
+{
+    wait();
+    return progress_->cache_hits.load(std::memory_order_acquire);
+}
+
 template <Traits traits>
 Result<std::vector<Receipt>> execute_block(
     Chain const &chain, Block &block, std::vector<Address> const &senders,
@@ -191,12 +341,15 @@ Result<std::vector<Receipt>> execute_block(
     BlockState &block_state, BlockHashBuffer const &block_hash_buffer,
     fiber::PriorityPool &priority_pool, BlockMetrics &block_metrics,
     std::vector<std::unique_ptr<CallTracerBase>> &call_tracers,
-    RevertTransactionFn const &revert_transaction)
+    RevertTransactionFn const &revert_transaction,
+    std::vector<std::optional<uint64_t>> const &predecessors)
 {
     TRACE_BLOCK_EVENT(StartBlock);
 
     MONAD_ASSERT(senders.size() == block.transactions.size());
     MONAD_ASSERT(senders.size() == call_tracers.size());
+    MONAD_ASSERT(
+        predecessors.empty() || predecessors.size() == senders.size());
 
     {
         State state{block_state, Incarnation{block.header.number, 0}};
@@ -231,6 +384,27 @@ Result<std::vector<Receipt>> execute_block(
     std::atomic<size_t> txn_exec_finished = 0;
     size_t const txn_count = block.transactions.size();
 
+    // CONFLICT SCHEDULING
+    // promises[i + 1] is waited on by transaction i + 1 only, held
+    // transactions wait on a separate shared future. Transactions start in
+    // priority order, so a predecessor is always started before the
+    // transactions held on it.
+    std::shared_ptr<boost::fibers::promise<void>[]> merged_promises{};
+    std::shared_ptr<boost::fibers::shared_future<void>[]> merged{};
+    uint64_t n_held = 0;
+    if (!predecessors.empty()) {
+        merged_promises.reset(new boost::fibers::promise<void>[txn_count]);
+        merged.reset(new boost::fibers::shared_future<void>[txn_count]);
+        for (size_t i = 0; i < txn_count; ++i) {
+            merged[i] = merged_promises[i].get_future().share();
+            if (predecessors[i].has_value()) {
+                MONAD_ASSERT(predecessors[i].value() < i);
+                ++n_held;
+            }
+        }
+    }
+    block_metrics.set_num_held(n_held);
+
     auto const tx_exec_begin = std::chrono::steady_clock::now();
     for (unsigned i = 0; i < txn_count; ++i) {
         priority_pool.submit(
@@ -248,7 +422,14 @@ Result<std::vector<Receipt>> execute_block(
              &block_metrics,
              &call_tracer = *call_tracers[i],
              &txn_exec_finished,
-             &revert_transaction = revert_transaction] {
+             &revert_transaction = revert_transaction,
+             merged_promises = merged_promises,
+             merged = merged,
+             predecessor = predecessors.empty() ? std::nullopt
+                                                : predecessors[i]] {
+                if (predecessor.has_value()) {
+                    merged[predecessor.value()].wait();
+                }
                 record_txn_marker_event(MONAD_EXEC_TXN_PERF_EVM_ENTER, i);
                 try {
                     results[i] = dispatch_transaction<traits>(
@@ -264,13 +445,27 @@ Result<std::vector<Receipt>> execute_block(
                         promises[i],
                         call_tracer,
                         revert_transaction);
+                    // BLOCK-STM
+                    // versions of a transaction that did not merge, which
+                    // executes with incarnation tx i + 1
+                    block_state.retire(i + 1);
                     promises[i + 1].set_value();
+                    if (merged_promises) {
+                        merged_promises[i].set_value();
+                    }
+                    // PARALLEL MERGE
+                    // off the serial path of the next transactions
+                    block_state.apply_merged();
                     record_txn_marker_event(MONAD_EXEC_TXN_PERF_EVM_EXIT, i);
                     record_txn_events(
                         i, transaction, sender, authorities, *results[i]);
                 }
                 catch (...) {
+                    block_state.retire(i + 1);
                     promises[i + 1].set_exception(std::current_exception());
+                    if (merged_promises) {
+                        merged_promises[i].set_value();
+                    }
                 }
                 txn_exec_finished.fetch_add(1, std::memory_order::relaxed);
             });
@@ -281,6 +476,10 @@ Result<std::vector<Receipt>> execute_block(
     block_metrics.set_tx_exec_time(
         std::chrono::duration_cast<std::chrono::microseconds>(
             std::chrono::steady_clock::now() - tx_exec_begin));
+    block_metrics.set_state_reads(
+        block_state.num_read_hits(),
+        block_state.num_read_misses(),
+        block_state.num_reads_coalesced());
 
     // All transactions have released their merge-order synchronization
     // primitive (promises[i + 1]) but some stragglers could still be running
@@ -25,8 +25,13 @@
 #include <category/execution/ethereum/trace/call_tracer.hpp>
 #include <category/vm/evm/traits.hpp>
 
+#include <boost/fiber/future/future.hpp>
 #include <evmc/evmc.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -35,23 +40,94 @@ MONAD_NAMESPACE_BEGIN
 
 class BlockHashBuffer;
 class BlockState;
+class RecoveryCache;
 class State;
 struct Block;
 struct Chain;
 
+// default revert function, no transaction is reverted
+inline bool
+no_revert_transaction(Address const &, Transaction const &, uint64_t, State &)
+{
+    return false;
+}
+
+// CONFLICT SCHEDULING
+// if `predecessors` is not empty, transaction i does not start executing
+// before transaction predecessors[i], if any, merged
 template <Traits traits>
 Result<std::vector<Receipt>> execute_block(
     Chain const &, Block &, std::vector<Address> const &senders,
     std::vector<std::vector<std::optional<Address>>> const &authorities,
     BlockState &, BlockHashBuffer const &, fiber::PriorityPool &,
     BlockMetrics &, std::vector<std::unique_ptr<CallTracerBase>> &,
-    RevertTransactionFn const & = [](Address const &, Transaction const &,
-                                     uint64_t, State &) { return false; });
+    RevertTransactionFn const & = no_revert_transaction,
+    std::vector<std::optional<uint64_t>> const &predecessors = {});
+
+std::vector<std::optional<Address>> recover_senders(
+    std::vector<Transaction> const &, fiber::PriorityPool &,
+    RecoveryCache * = nullptr);
+
+// Sender and EIP-7702 authority recovery that runs on the priority pool in
+// the background, so that it overlaps other work (e.g. the commit of the
+// previous block) until the results are needed. The elements of the
+// transactions and the cache, if any, must outlive it; the vector itself may
+// be moved, which keeps its elements in place.
+class SenderRecovery final
+{
+    struct Progress
+    {
+        std::atomic<size_t> remaining;
+        std::atomic<std::chrono::steady_clock::rep> end;
+        std::atomic<uint64_t> cache_hits;
+    };
+
+    std::vector<std::optional<Address>> senders_;
+    std::vector<std::vector<std::optional<Address>>> authorities_;
+    std::vector<boost::fibers::future<void>> pending_{};
+    std::shared_ptr<Progress> progress_;
+    std::chrono::steady_clock::time_point const begin_;
+    std::chrono::microseconds stall_time_{0};
+
+public:
+    SenderRecovery(
+        std::vector<Transaction> const &, fiber::PriorityPool &,
+        RecoveryCache * = nullptr);
+
+    SenderRecovery(SenderRecovery const &) = delete;
+    SenderRecovery &operator=(SenderRecovery const &) = delete;
+
+    ~SenderRecovery();
+
+    void wait();
+
+    std::vector<std::optional<Address>> const &senders()
+    {
+        wait();
+        return senders_;
+    }
+
+    std::vector<std::vector<std::optional<Address>>> const &authorities()
+    {
+        wait();
+        return authorities_;
+    }
+
+    // from submission until the last recovery finished
+    std::chrono::microseconds recovery_time();
+
+    // time spent blocked on wait()
+    std::chrono::microseconds stall_time() const
+    {
+        return stall_time_;
+    }
 
-std::vector<std::optional<Address>>
-recover_senders(std::vector<Transaction> const &, fiber::PriorityPool &);
+    // recoveries of these transactions served by the cache
+    uint64_t num_cache_hits();
+};
 
-std::vector<std::vector<std::optional<Address>>>
-recover_authorities(std::vector<Transaction> const &, fiber::PriorityPool &);
+std::vector<std::vector<std::optional<Address>>> recover_authorities(
+    std::vector<Transaction> const &, fiber::PriorityPool &,
+    RecoveryCache * = nullptr);
 
 MONAD_NAMESPACE_END
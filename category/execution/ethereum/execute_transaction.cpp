@@ -19,6 +19,8 @@
 #include <category/execution/ethereum/block_hash_buffer.hpp>
 #include <category/execution/ethereum/chain/chain.hpp>
 #include <category/execution/ethereum/core/block.hpp>
+#include <category/execution/ethereum/core/fmt/address_fmt.hpp>
+#include <category/execution/ethereum/core/fmt/bytes_fmt.hpp>
 #include <category/execution/ethereum/core/transaction.hpp>
 #include <category/execution/ethereum/evm.hpp>
 #include <category/execution/ethereum/evmc_host.hpp>
@@ -40,9 +42,13 @@
 #include <boost/outcome/try.hpp>
 #include <intx/intx.hpp>
 
+#include <quill/Quill.h>
+
 #include <algorithm>
+#include <chrono>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <utility>
 
 MONAD_ANONYMOUS_NAMESPACE_BEGIN
@@ -417,6 +423,9 @@ Result<Receipt> ExecuteTransaction<traits>::operator()()
         header_.excess_blob_gas,
         chain_.get_chain_id()));
 
+    // PARALLEL MERGE
+    // from the merge of the previous transaction until this one merged
+    std::chrono::steady_clock::time_point serial_begin;
     {
         TRACE_TXN_EVENT(StartExecution);
 
@@ -427,22 +436,34 @@ Result<Receipt> ExecuteTransaction<traits>::operator()()
 
         auto result = execute_impl2(state);
 
+        // BLOCK-STM
+        // the sender and beneficiary balances are only final after
+        // execute_final
+        if (result.has_value()) {
+            block_state_.publish(state, {sender_, header_.beneficiary});
+        }
+
         {
             TRACE_TXN_EVENT(StartStall);
             prev_.get_future().wait();
         }
+        serial_begin = std::chrono::steady_clock::now();
 
         if (block_state_.can_merge(state)) {
             if (result.has_error()) {
+                block_metrics_.add_serial_time(
+                    std::chrono::steady_clock::now() - serial_begin);
                 return std::move(result.error());
             }
             auto const receipt = execute_final(state, result.value());
             call_tracer_.on_finish(receipt.gas_used);
             block_state_.merge(state);
+            block_metrics_.add_serial_time(
+                std::chrono::steady_clock::now() - serial_begin);
             return receipt;
         }
+        record_retry(block_metrics_, i_, state.merge_conflict());
     }
-    block_metrics_.inc_retries();
     {
         TRACE_TXN_EVENT(StartRetry);
 
@@ -454,17 +475,42 @@ Result<Receipt> ExecuteTransaction<traits>::operator()()
 
         MONAD_ASSERT(block_state_.can_merge(state));
         if (result.has_error()) {
+            block_metrics_.add_serial_time(
+                std::chrono::steady_clock::now() - serial_begin);
             return std::move(result.error());
         }
         auto const receipt = execute_final(state, result.value());
         call_tracer_.on_finish(receipt.gas_used);
         block_state_.merge(state);
+        block_metrics_.add_serial_time(
+            std::chrono::steady_clock::now() - serial_begin);
         return receipt;
     }
 }
 
 EXPLICIT_TRAITS_CLASS(ExecuteTransaction);
 
+void record_retry(
+    BlockMetrics &block_metrics, uint64_t const i,
+    std::optional<MergeConflict> const &conflict)
+{
+    block_metrics.inc_retries();
+    if (MONAD_UNLIKELY(!conflict.has_value())) {
+        return;
+    }
+    block_metrics.record_conflict(i, conflict->address);
+    if (conflict->key.has_value()) {
+        LOG_DEBUG(
+            "tx {} retry, conflict on storage {} {}",
+            i,
+            conflict->address,
+            conflict->key.value());
+    }
+    else {
+        LOG_DEBUG("tx {} retry, conflict on account {}", i, conflict->address);
+    }
+}
+
 uint64_t g_star(
     evmc_revision const rev, Transaction const &tx,
     uint64_t const gas_remaining, uint64_t const refund)
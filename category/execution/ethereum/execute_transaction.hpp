@@ -25,6 +25,7 @@
 #include <evmc/evmc.hpp>
 
 #include <cstdint>
+#include <optional>
 #include <vector>
 
 MONAD_NAMESPACE_BEGIN
@@ -37,6 +38,7 @@ struct CallTracerBase;
 struct Chain;
 template <Traits traits>
 struct EvmcHost;
+struct MergeConflict;
 class State;
 struct Transaction;
 
@@ -108,6 +110,10 @@ public:
     Result<Receipt> operator()();
 };
 
+// record a retry of transaction `i`, caused by `conflict` failing to merge
+void record_retry(
+    BlockMetrics &, uint64_t i, std::optional<MergeConflict> const &conflict);
+
 uint64_t g_star(
     evmc_revision, Transaction const &, uint64_t gas_remaining,
     uint64_t gas_refund);
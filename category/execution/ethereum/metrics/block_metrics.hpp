@@ -16,8 +16,12 @@
 #pragma once
 
 #include <category/core/config.hpp>
+#include <category/execution/ethereum/core/address.hpp>
 
 #include <chrono>
+#include <cstdint>
+#include <utility>
+#include <vector>
 
 MONAD_NAMESPACE_BEGIN
 
@@ -25,6 +29,13 @@ class BlockMetrics
 {
     uint32_t n_retries_{0};
     std::chrono::microseconds tx_exec_time_{1};
+    std::chrono::nanoseconds serial_time_{0};
+    std::vector<std::pair<uint64_t, Address>> conflicts_{};
+    uint64_t n_held_{0};
+    uint64_t n_prefetched_{0};
+    uint64_t n_read_hits_{0};
+    uint64_t n_read_misses_{0};
+    uint64_t n_reads_coalesced_{0};
 
 public:
     void inc_retries()
@@ -37,6 +48,74 @@ public:
         return n_retries_;
     }
 
+    // called in merge order, once per retry of transaction `i`
+    void record_conflict(uint64_t const i, Address const &address)
+    {
+        conflicts_.emplace_back(i, address);
+    }
+
+    std::vector<std::pair<uint64_t, Address>> const &conflicts() const
+    {
+        return conflicts_;
+    }
+
+    void set_num_held(uint64_t const n)
+    {
+        n_held_ = n;
+    }
+
+    uint64_t num_held() const
+    {
+        return n_held_;
+    }
+
+    void set_num_prefetched(uint64_t const n)
+    {
+        n_prefetched_ = n;
+    }
+
+    uint64_t num_prefetched() const
+    {
+        return n_prefetched_;
+    }
+
+    void set_state_reads(
+        uint64_t const hits, uint64_t const misses, uint64_t const coalesced)
+    {
+        n_read_hits_ = hits;
+        n_read_misses_ = misses;
+        n_reads_coalesced_ = coalesced;
+    }
+
+    uint64_t num_read_hits() const
+    {
+        return n_read_hits_;
+    }
+
+    uint64_t num_read_misses() const
+    {
+        return n_read_misses_;
+    }
+
+    uint64_t num_reads_coalesced() const
+    {
+        return n_reads_coalesced_;
+    }
+
+    // PARALLEL MERGE
+    // called in merge order, with the time transaction `i` spent between
+    // the merge of its predecessor and its own merge
+    void add_serial_time(std::chrono::nanoseconds const time)
+    {
+        serial_time_ += time;
+    }
+
+    std::chrono::microseconds serial_time() const
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            serial_time_);
+    }
+
     void set_tx_exec_time(std::chrono::microseconds const exec_time)
     {
         tx_exec_time_ = exec_time;
@@ -15,6 +15,7 @@
 
 #include <category/core/assert.h>
 #include <category/core/bytes.hpp>
+#include <category/core/bytes_hash_compare.hpp>
 #include <category/core/config.hpp>
 #include <category/core/likely.h>
 #include <category/execution/ethereum/core/account.hpp>
@@ -26,6 +27,7 @@
 #include <category/execution/ethereum/db/db.hpp>
 #include <category/execution/ethereum/state2/block_state.hpp>
 #include <category/execution/ethereum/state2/fmt/state_deltas_fmt.hpp> // NOLINT
+#include <category/execution/ethereum/state2/multi_version_state.hpp>
 #include <category/execution/ethereum/state2/state_deltas.hpp>
 #include <category/execution/ethereum/state3/account_state.hpp>
 #include <category/execution/ethereum/state3/state.hpp>
@@ -38,7 +40,12 @@
 
 #include <quill/Quill.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -49,22 +56,97 @@ BlockState::BlockState(Db &db, vm::VM &monad_vm)
     : db_{db}
     , vm_{monad_vm}
     , state_(std::make_unique<StateDeltas>())
+    , merge_shards_{std::make_unique<MergeShard[]>(MERGE_SHARDS)}
 {
 }
 
-std::optional<Account> BlockState::read_account(Address const &address)
+BlockState::MergeShard &BlockState::merge_shard(Address const &address) const
+{
+    return merge_shards_
+        [BytesHashCompare<Address>{}.hash(address) % MERGE_SHARDS];
+}
+
+void BlockState::apply(MergeShard &shard) const
+{
+    MONAD_ASSERT(state_);
+    for (auto const &write : shard.pending) {
+        StateDeltas::accessor it{};
+        MONAD_ASSERT(state_->find(it, write.address));
+        it->second.account.second = write.account;
+        if (write.account.has_value()) {
+            for (auto const &[key, value] : write.storage) {
+                StorageDeltas::accessor it2{};
+                if (it->second.storage.find(it2, key)) {
+                    it2->second.second = value;
+                }
+                else {
+                    it->second.storage.emplace(
+                        key, std::make_pair(bytes32_t{}, value));
+                }
+            }
+        }
+        else {
+            it->second.storage.clear();
+        }
+    }
+    shard.pending.clear();
+    shard.n_pending.store(0, std::memory_order_release);
+}
+
+void BlockState::apply(Address const &address) const
+{
+    auto &shard = merge_shard(address);
+    if (MONAD_LIKELY(shard.n_pending.load(std::memory_order_acquire) == 0)) {
+        return;
+    }
+    std::unique_lock const lock{shard.lock};
+    apply(shard);
+}
+
+void BlockState::apply_all()
 {
+    for (size_t i = 0; i < MERGE_SHARDS; ++i) {
+        std::unique_lock const lock{merge_shards_[i].lock};
+        apply(merge_shards_[i]);
+    }
+}
+
+void BlockState::apply_merged()
+{
+    for (size_t i = 0; i < MERGE_SHARDS; ++i) {
+        auto &shard = merge_shards_[i];
+        if (shard.n_pending.load(std::memory_order_acquire) == 0) {
+            continue;
+        }
+        std::unique_lock lock{shard.lock, std::try_to_lock};
+        if (lock.owns_lock()) {
+            apply(shard);
+        }
+    }
+}
+
+std::optional<Account>
+BlockState::read_account_impl(Address const &address, bool const count)
+{
+    apply(address);
     // block state
     {
         StateDeltas::const_accessor it{};
         MONAD_ASSERT(state_);
         if (MONAD_LIKELY(state_->find(it, address))) {
+            if (count) {
+                n_read_hits_.fetch_add(1, std::memory_order_relaxed);
+            }
             return it->second.account.second;
         }
     }
     // database
     {
-        auto const result = db_.read_account(address);
+        if (count) {
+            n_read_misses_.fetch_add(1, std::memory_order_relaxed);
+        }
+        auto const result = account_reads_.read(
+            address, [&] { return db_.read_account(address); });
         StateDeltas::const_accessor it{};
         state_->emplace(
             it,
@@ -74,10 +156,12 @@ std::optional<Account> BlockState::read_account(Address const &address)
     }
 }
 
-bytes32_t BlockState::read_storage(
-    Address const &address, Incarnation const incarnation, bytes32_t const &key)
+bytes32_t BlockState::read_storage_impl(
+    Address const &address, Incarnation const incarnation, bytes32_t const &key,
+    bool const count)
 {
     bool read_storage = false;
+    apply(address);
     // block state
     {
         StateDeltas::const_accessor it{};
@@ -91,6 +175,9 @@ bytes32_t BlockState::read_storage(
         {
             StorageDeltas::const_accessor it2{};
             if (MONAD_LIKELY(storage.find(it2, key))) {
+                if (count) {
+                    n_read_hits_.fetch_add(1, std::memory_order_relaxed);
+                }
                 return it2->second.second;
             }
         }
@@ -99,11 +186,20 @@ bytes32_t BlockState::read_storage(
             read_storage = true;
         }
     }
+    if (count) {
+        (read_storage ? n_read_misses_ : n_read_hits_)
+            .fetch_add(1, std::memory_order_relaxed);
+    }
     // database
     {
-        auto const result = read_storage
-                                ? db_.read_storage(address, incarnation, key)
-                                : bytes32_t{};
+        auto const result =
+            read_storage
+                ? storage_reads_.read(
+                      MultiVersionState::StorageKey{address, incarnation, key},
+                      [&] {
+                          return db_.read_storage(address, incarnation, key);
+                      })
+                : bytes32_t{};
         StateDeltas::accessor it{};
         MONAD_ASSERT(state_->find(it, address));
         auto const &account = it->second.account.second;
@@ -119,6 +215,97 @@ bytes32_t BlockState::read_storage(
     }
 }
 
+std::optional<Account> BlockState::read_account(Address const &address)
+{
+    return read_account_impl(address, false);
+}
+
+bytes32_t BlockState::read_storage(
+    Address const &address, Incarnation const incarnation, bytes32_t const &key)
+{
+    return read_storage_impl(address, incarnation, key, false);
+}
+
+std::optional<Account>
+BlockState::read_account(Address const &address, uint64_t const txn)
+{
+    // the block state is always read so that it keeps the original of every
+    // account that can_merge validates against
+    auto account = read_account_impl(address, true);
+    if (MONAD_LIKELY(versions_.empty())) {
+        return account;
+    }
+    if (auto version = versions_.read_account(address, txn)) {
+        return std::move(version).value();
+    }
+    return account;
+}
+
+bytes32_t BlockState::read_storage(
+    Address const &address, Incarnation const incarnation, bytes32_t const &key,
+    uint64_t const txn)
+{
+    auto const value = read_storage_impl(address, incarnation, key, true);
+    if (MONAD_LIKELY(versions_.empty())) {
+        return value;
+    }
+    return versions_.read_storage(address, incarnation, key, txn)
+        .value_or(value);
+}
+
+void BlockState::publish(
+    State const &state, std::initializer_list<Address> const unsettled)
+{
+    auto writer = versions_.publish(state.incarnation().get_tx());
+    auto const &original = state.original();
+    for (auto const &[address, stack] : state.current()) {
+        if (std::ranges::find(unsettled, address) != unsettled.end()) {
+            continue;
+        }
+        auto const &account_state = stack.recent();
+        auto const &account = account_state.account_;
+        // destructed at the end of the transaction
+        if (account_state.is_destructed() ||
+            (account_state.is_touched() && is_dead(account))) {
+            continue;
+        }
+        auto const it = original.find(address);
+        MONAD_ASSERT(it != original.end());
+        auto const &orig_account_state = it->second;
+        auto const &orig_account = orig_account_state.account_;
+        if (!account.has_value()) {
+            continue;
+        }
+        // new code is only readable by other transactions once merged
+        if (account->code_hash != NULL_HASH &&
+            (!orig_account.has_value() ||
+             orig_account->code_hash != account->code_hash)) {
+            continue;
+        }
+        if (account != orig_account) {
+            writer.write_account(address, account);
+        }
+        bool const same_incarnation =
+            orig_account.has_value() &&
+            orig_account->incarnation == account->incarnation;
+        auto const &orig_storage = orig_account_state.storage_;
+        for (auto const &[key, value] : account_state.storage_) {
+            if (same_incarnation) {
+                auto const it2 = orig_storage.find(key);
+                if (it2 != orig_storage.end() && it2->second == value) {
+                    continue;
+                }
+            }
+            writer.write_storage(address, account->incarnation, key, value);
+        }
+    }
+}
+
+void BlockState::retire(uint64_t const txn)
+{
+    versions_.retire(txn);
+}
+
 vm::SharedVarcode BlockState::read_code(bytes32_t const &code_hash)
 {
     // vm
@@ -150,6 +337,7 @@ bool BlockState::can_merge(State &state) const
         OriginalAccountState &account_state = kv.second;
         auto const &account = account_state.account_;
         auto const &storage = account_state.storage_;
+        apply(address);
         StateDeltas::const_accessor it{};
         MONAD_ASSERT(state_->find(it, address));
         if (account != it->second.account.second) {
@@ -158,6 +346,7 @@ bool BlockState::can_merge(State &state) const
             // state up until this transaction
             if (!state.try_fix_account_mismatch(
                     address, account_state, it->second.account.second)) {
+                state.set_merge_conflict(address);
                 return false;
             }
         }
@@ -166,11 +355,13 @@ bool BlockState::can_merge(State &state) const
             StorageDeltas::const_accessor it2{};
             if (it->second.storage.find(it2, key)) {
                 if (value != it2->second.second) {
+                    state.set_merge_conflict(address, key);
                     return false;
                 }
             }
             else {
                 if (value) {
+                    state.set_merge_conflict(address, key);
                     return false;
                 }
             }
@@ -179,11 +370,11 @@ bool BlockState::can_merge(State &state) const
     return true;
 }
 
-void BlockState::merge(State const &state)
+void BlockState::merge(State &state)
 {
     ankerl::unordered_dense::segmented_set<bytes32_t> code_hashes;
 
-    auto const &current = state.current();
+    auto &current = state.current();
     for (auto const &[address, stack] : current) {
         MONAD_ASSERT(stack.size() == 1);
         MONAD_ASSERT(stack.version() == 0);
@@ -204,29 +395,27 @@ void BlockState::merge(State const &state)
     }
 
     MONAD_ASSERT(state_);
-    for (auto const &[address, stack] : current) {
-        auto const &account_state = stack.recent();
-        auto const &account = account_state.account_;
-        auto const &storage = account_state.storage_;
-        StateDeltas::accessor it{};
-        MONAD_ASSERT(state_->find(it, address));
-        it->second.account.second = account;
-        if (account.has_value()) {
-            for (auto const &[key, value] : storage) {
-                StorageDeltas::accessor it2{};
-                if (it->second.storage.find(it2, key)) {
-                    it2->second.second = value;
-                }
-                else {
-                    it->second.storage.emplace(
-                        key, std::make_pair(bytes32_t{}, value));
-                }
-            }
-        }
-        else {
-            it->second.storage.clear();
+    for (auto &[address, stack] : current) {
+        auto &account_state = stack.recent();
+        MergedWrite write{
+            .address = address,
+            .account = account_state.account_,
+            .storage = {}};
+        if (write.account.has_value()) {
+            // moved, not copied, the write set is not allocated again in
+            // the serial section
+            write.storage = std::move(account_state.storage_);
         }
+        auto &shard = merge_shard(address);
+        std::unique_lock const lock{shard.lock};
+        shard.pending.push_back(std::move(write));
+        shard.n_pending.fetch_add(1, std::memory_order_release);
     }
+
+    // BLOCK-STM
+    // only once the merged values are visible, which they are to every
+    // reader of the block state that comes after the merge
+    versions_.retire(state.incarnation().get_tx());
 }
 
 void BlockState::commit(
@@ -238,6 +427,7 @@ void BlockState::commit(
     std::vector<BlockHeader> const &ommers,
     std::optional<std::vector<Withdrawal>> const &withdrawals)
 {
+    apply_all();
     db_.commit(
         std::move(state_),
         code_,
@@ -253,6 +443,7 @@ void BlockState::commit(
 
 void BlockState::log_debug()
 {
+    apply_all();
     MONAD_ASSERT(state_);
     LOG_DEBUG("State Deltas: {}", *state_);
     LOG_DEBUG("Code Deltas: {}", code_);
@@ -16,17 +16,30 @@
 #pragma once
 
 #include <category/core/bytes.hpp>
+#include <category/core/bytes_hash_compare.hpp>
 #include <category/core/config.hpp>
+#include <category/core/synchronization/spin_lock.hpp>
+#include <category/execution/ethereum/core/account.hpp>
+#include <category/execution/ethereum/core/address.hpp>
 #include <category/execution/ethereum/core/block.hpp>
 #include <category/execution/ethereum/core/receipt.hpp>
 #include <category/execution/ethereum/core/transaction.hpp>
 #include <category/execution/ethereum/db/db.hpp>
+#include <category/execution/ethereum/state2/multi_version_state.hpp>
+#include <category/execution/ethereum/state2/single_flight.hpp>
 #include <category/execution/ethereum/state2/state_deltas.hpp>
+#include <category/execution/ethereum/state3/account_state.hpp>
 #include <category/execution/ethereum/trace/call_tracer.hpp>
 #include <category/execution/ethereum/types/incarnation.hpp>
 #include <category/vm/vm.hpp>
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
 #include <memory>
+#include <optional>
+#include <utility>
 #include <vector>
 
 MONAD_NAMESPACE_BEGIN
@@ -35,10 +48,55 @@ class State;
 
 class BlockState final
 {
+    // PARALLEL MERGE
+    // writes of a merged transaction not applied to the block state yet
+    struct MergedWrite
+    {
+        Address address;
+        std::optional<Account> account;
+        AccountState::Map<bytes32_t, bytes32_t> storage;
+    };
+
+    struct alignas(64) MergeShard
+    {
+        SpinLock lock{};
+        std::atomic<size_t> n_pending{0};
+        std::vector<MergedWrite> pending{};
+    };
+
+    static constexpr size_t MERGE_SHARDS = 64;
+
     Db &db_;
     vm::VM &vm_;
     std::unique_ptr<StateDeltas> state_;
     Code code_;
+    MultiVersionState versions_;
+    std::atomic<uint64_t> n_read_hits_{0};
+    std::atomic<uint64_t> n_read_misses_{0};
+    SingleFlight<
+        Address, std::optional<Account>, BytesHashCompare<Address>>
+        account_reads_{};
+    SingleFlight<
+        MultiVersionState::StorageKey, bytes32_t,
+        BytesHashCompare<MultiVersionState::StorageKey>>
+        storage_reads_{};
+    std::unique_ptr<MergeShard[]> merge_shards_;
+
+    MergeShard &merge_shard(Address const &) const;
+
+    // applies the pending writes of a shard, in merge order, with its lock
+    // held
+    void apply(MergeShard &) const;
+
+    // makes the merged writes to an address visible in the block state
+    void apply(Address const &) const;
+
+    void apply_all();
+
+    std::optional<Account> read_account_impl(Address const &, bool count);
+
+    bytes32_t read_storage_impl(
+        Address const &, Incarnation, bytes32_t const &key, bool count);
 
 public:
     BlockState(Db &, vm::VM &);
@@ -52,11 +110,65 @@ public:
 
     bytes32_t read_storage(Address const &, Incarnation, bytes32_t const &key);
 
+    // BLOCK-STM
+    // speculative reads on behalf of the transaction with incarnation tx
+    // `txn`, which see the latest version published by an earlier
+    // transaction that has not merged yet
+    std::optional<Account> read_account(Address const &, uint64_t txn);
+
+    bytes32_t read_storage(
+        Address const &, Incarnation, bytes32_t const &key, uint64_t txn);
+
+    // BLOCK-STM
+    // publish the writes of an executed transaction to later transactions
+    // before it merges. `unsettled` accounts are still modified after
+    // execution and are not published.
+    void publish(State const &, std::initializer_list<Address> unsettled);
+
+    // BLOCK-STM
+    // retire the versions published by `txn`, which must happen before the
+    // next transaction merges. merge() retires the versions of the merged
+    // transaction.
+    void retire(uint64_t txn);
+
     vm::SharedVarcode read_code(bytes32_t const &);
 
+    // PREFETCH
+    // reads on behalf of transactions served by the block state (hits) or by
+    // the database (misses). Plain reads, as issued by the prefetcher, are
+    // not counted.
+    uint64_t num_read_hits() const
+    {
+        return n_read_hits_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t num_read_misses() const
+    {
+        return n_read_misses_.load(std::memory_order_relaxed);
+    }
+
+    // READ COALESCING
+    // database reads avoided because another fiber was already reading the
+    // same account or slot
+    uint64_t num_reads_coalesced() const
+    {
+        return account_reads_.num_coalesced() + storage_reads_.num_coalesced();
+    }
+
     bool can_merge(State &) const;
 
-    void merge(State const &);
+    // PARALLEL MERGE
+    // merge() only buffers the writes of the transaction per shard of
+    // addresses, which keeps their application out of the serial section of
+    // the transaction. Shards are applied in merge order by apply_merged()
+    // or by the first later access to the shard, so every read of the block
+    // state sees all the writes merged before it. The storage writes are
+    // moved out of the state, which must not be read after the merge.
+    void merge(State &);
+
+    // applies the shards that no one else is applying, called by a
+    // transaction once it released the next one
+    void apply_merged();
 
     void commit(
         bytes32_t const &block_id, BlockHeader const &,
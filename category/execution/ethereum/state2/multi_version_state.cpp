@@ -0,0 +1,177 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/core/assert.h>
+#include <category/core/bytes.hpp>
+#include <category/core/config.hpp>
+#include <category/core/likely.h>
+#include <category/execution/ethereum/core/account.hpp>
+#include <category/execution/ethereum/core/address.hpp>
+#include <category/execution/ethereum/state2/multi_version_state.hpp>
+#include <category/execution/ethereum/types/incarnation.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+MONAD_NAMESPACE_BEGIN
+
+MONAD_ANONYMOUS_NAMESPACE_BEGIN
+
+template <class Versions, class T>
+void insert_version(Versions &versions, uint64_t const txn, T const &value)
+{
+    auto const it = std::find_if(
+        versions.begin(), versions.end(), [txn](auto const &version) {
+            return version.txn >= txn;
+        });
+    if (it != versions.end() && it->txn == txn) {
+        it->value = value;
+    }
+    else {
+        versions.insert(it, typename Versions::value_type{txn, value});
+    }
+}
+
+// latest version written before `reader`
+template <class Versions>
+typename Versions::const_pointer
+find_version(Versions const &versions, uint64_t const reader)
+{
+    for (auto it = versions.rbegin(); it != versions.rend(); ++it) {
+        if (it->txn < reader) {
+            return &*it;
+        }
+    }
+    return nullptr;
+}
+
+template <class Map, class Key>
+void erase_version(Map &map, Key const &key, uint64_t const txn)
+{
+    typename Map::accessor it{};
+    if (!map.find(it, key)) {
+        return;
+    }
+    auto &versions = it->second;
+    std::erase_if(versions, [txn](auto const &version) {
+        return version.txn == txn;
+    });
+    if (versions.empty()) {
+        map.erase(it);
+    }
+}
+
+MONAD_ANONYMOUS_NAMESPACE_END
+
+MultiVersionState::Writer::Writer(MultiVersionState &mv, uint64_t const txn)
+    : mv_{mv}
+    , txn_{txn}
+{
+}
+
+MultiVersionState::Writer::~Writer()
+{
+    if (published_.accounts.empty() && published_.storage.empty()) {
+        return;
+    }
+    PublishedMap::accessor it{};
+    MONAD_ASSERT(mv_.published_.insert(it, txn_));
+    it->second = std::move(published_);
+    mv_.num_published_.fetch_add(1, std::memory_order_release);
+}
+
+void MultiVersionState::Writer::write_account(
+    Address const &address, std::optional<Account> const &account)
+{
+    {
+        AccountVersions::accessor it{};
+        mv_.accounts_.insert(it, address);
+        insert_version(it->second, txn_, account);
+    }
+    published_.accounts.push_back(address);
+}
+
+void MultiVersionState::Writer::write_storage(
+    Address const &address, Incarnation const incarnation,
+    bytes32_t const &key, bytes32_t const &value)
+{
+    StorageKey const skey{address, incarnation, key};
+    {
+        StorageVersions::accessor it{};
+        mv_.storage_.insert(it, skey);
+        insert_version(it->second, txn_, value);
+    }
+    published_.storage.push_back(skey);
+}
+
+MultiVersionState::Writer MultiVersionState::publish(uint64_t const txn)
+{
+    retire(txn);
+    return Writer{*this, txn};
+}
+
+void MultiVersionState::retire(uint64_t const txn)
+{
+    Published published;
+    {
+        PublishedMap::accessor it{};
+        if (MONAD_LIKELY(!published_.find(it, txn))) {
+            return;
+        }
+        published = std::move(it->second);
+        published_.erase(it);
+    }
+    for (auto const &address : published.accounts) {
+        erase_version(accounts_, address, txn);
+    }
+    for (auto const &skey : published.storage) {
+        erase_version(storage_, skey, txn);
+    }
+    num_published_.fetch_sub(1, std::memory_order_release);
+}
+
+std::optional<std::optional<Account>> MultiVersionState::read_account(
+    Address const &address, uint64_t const reader) const
+{
+    AccountVersions::const_accessor it{};
+    if (!accounts_.find(it, address)) {
+        return std::nullopt;
+    }
+    auto const *const version = find_version(it->second, reader);
+    if (!version) {
+        return std::nullopt;
+    }
+    return version->value;
+}
+
+std::optional<bytes32_t> MultiVersionState::read_storage(
+    Address const &address, Incarnation const incarnation,
+    bytes32_t const &key, uint64_t const reader) const
+{
+    StorageVersions::const_accessor it{};
+    if (!storage_.find(it, StorageKey{address, incarnation, key})) {
+        return std::nullopt;
+    }
+    auto const *const version = find_version(it->second, reader);
+    if (!version) {
+        return std::nullopt;
+    }
+    return version->value;
+}
+
+MONAD_NAMESPACE_END
@@ -0,0 +1,146 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <category/core/bytes.hpp>
+#include <category/core/bytes_hash_compare.hpp>
+#include <category/core/config.hpp>
+#include <category/execution/ethereum/core/account.hpp>
+#include <category/execution/ethereum/core/address.hpp>
+#include <category/execution/ethereum/types/incarnation.hpp>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <oneapi/tbb/concurrent_hash_map.h>
+#pragma GCC diagnostic pop
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+MONAD_NAMESPACE_BEGIN
+
+// BLOCK-STM
+// writes of transactions that finished executing but have not merged yet,
+// keyed by account or storage slot and by the writing transaction. A
+// transaction reads the latest version written by an earlier transaction,
+// so it does not have to wait for that transaction to merge to observe its
+// writes. Versions are speculative: everything read from here is validated
+// against the merged block state by BlockState::can_merge, and a reader
+// that observed a version that did not survive is re-executed.
+//
+// Transactions are identified by their incarnation tx number. Versions of a
+// transaction must be retired before the next transaction is allowed to
+// merge, after which nothing reads them.
+class MultiVersionState final
+{
+public:
+    struct StorageKey
+    {
+        static constexpr size_t k_bytes =
+            sizeof(Address) + sizeof(Incarnation) + sizeof(bytes32_t);
+
+        uint8_t bytes[k_bytes];
+
+        StorageKey() = default;
+
+        StorageKey(
+            Address const &addr, Incarnation incarnation, bytes32_t const &key)
+        {
+            memcpy(bytes, addr.bytes, sizeof(Address));
+            memcpy(&bytes[sizeof(Address)], &incarnation, sizeof(Incarnation));
+            memcpy(
+                &bytes[sizeof(Address) + sizeof(Incarnation)],
+                key.bytes,
+                sizeof(bytes32_t));
+        }
+    };
+
+private:
+    template <class T>
+    struct Version
+    {
+        uint64_t txn;
+        T value;
+    };
+
+    // sorted by txn, rarely more than a few entries
+    template <class T>
+    using Versions = std::vector<Version<T>>;
+
+    using AccountVersions = oneapi::tbb::concurrent_hash_map<
+        Address, Versions<std::optional<Account>>, BytesHashCompare<Address>>;
+    using StorageVersions = oneapi::tbb::concurrent_hash_map<
+        StorageKey, Versions<bytes32_t>, BytesHashCompare<StorageKey>>;
+
+    struct Published
+    {
+        std::vector<Address> accounts{};
+        std::vector<StorageKey> storage{};
+    };
+
+    using PublishedMap = oneapi::tbb::concurrent_hash_map<uint64_t, Published>;
+
+    AccountVersions accounts_{};
+    StorageVersions storage_{};
+    PublishedMap published_{};
+    std::atomic<size_t> num_published_{0};
+
+public:
+    class Writer
+    {
+        friend class MultiVersionState;
+
+        MultiVersionState &mv_;
+        uint64_t const txn_;
+        Published published_{};
+
+        Writer(MultiVersionState &, uint64_t txn);
+
+    public:
+        Writer(Writer const &) = delete;
+        Writer &operator=(Writer const &) = delete;
+        ~Writer();
+
+        void write_account(Address const &, std::optional<Account> const &);
+
+        void write_storage(
+            Address const &, Incarnation, bytes32_t const &key,
+            bytes32_t const &value);
+    };
+
+    // replaces any versions previously published by `txn`. Versions are
+    // visible as soon as they are written.
+    Writer publish(uint64_t txn);
+
+    void retire(uint64_t txn);
+
+    std::optional<std::optional<Account>>
+    read_account(Address const &, uint64_t reader) const;
+
+    std::optional<bytes32_t> read_storage(
+        Address const &, Incarnation, bytes32_t const &key,
+        uint64_t reader) const;
+
+    bool empty() const
+    {
+        return num_published_.load(std::memory_order_acquire) == 0;
+    }
+};
+
+MONAD_NAMESPACE_END
@@ -0,0 +1,84 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <category/core/config.hpp>
+
+#include <boost/fiber/future/future.hpp>
+#include <boost/fiber/future/promise.hpp>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <oneapi/tbb/concurrent_hash_map.h>
+#pragma GCC diagnostic pop
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <utility>
+
+MONAD_NAMESPACE_BEGIN
+
+// READ COALESCING
+// Single-flight reads: of the readers that concurrently miss the same key,
+// the first one issues the read and the others wait for its result instead
+// of issuing the same read again. Readers wait on fiber futures, so a
+// waiting fiber yields its thread to other transactions.
+template <class Key, class T, class HashCompare>
+class SingleFlight final
+{
+    using InFlight = oneapi::tbb::concurrent_hash_map<
+        Key, boost::fibers::shared_future<T>, HashCompare>;
+
+    InFlight in_flight_{};
+    std::atomic<uint64_t> n_coalesced_{0};
+
+public:
+    template <class Read>
+    T read(Key const &key, Read &&read)
+    {
+        boost::fibers::promise<T> promise;
+        {
+            typename InFlight::accessor it{};
+            if (!in_flight_.insert(it, key)) {
+                auto const future = it->second;
+                it.release();
+                n_coalesced_.fetch_add(1, std::memory_order_relaxed);
+                return future.get();
+            }
+            it->second = promise.get_future().share();
+        }
+        try {
+            T result = std::forward<Read>(read)();
+            promise.set_value(result);
+            in_flight_.erase(key);
+            return result;
+        }
+        catch (...) {
+            promise.set_exception(std::current_exception());
+            in_flight_.erase(key);
+            throw;
+        }
+    }
+
+    // reads that waited on the read of another reader
+    uint64_t num_coalesced() const
+    {
+        return n_coalesced_.load(std::memory_order_relaxed);
+    }
+};
+
+MONAD_NAMESPACE_END
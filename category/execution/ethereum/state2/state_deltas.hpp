@@ -28,6 +28,8 @@
 #include <oneapi/tbb/concurrent_hash_map.h>
 #pragma GCC diagnostic pop
 
+#include <cstddef>
+#include <initializer_list>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -52,13 +54,139 @@ using StorageDeltas = oneapi::tbb::concurrent_hash_map<bytes32_t, StorageDelta>;
 static_assert(sizeof(StorageDeltas) == 576);
 static_assert(alignof(StorageDeltas) == 8);
 
+// Storage deltas of an account, allocated with the first slot. Most accounts
+// in a block state never have storage (senders, recipients without code,
+// the beneficiary), and an empty StorageDeltas costs as much as the rest of
+// the state delta three times over.
+//
+// Allocation and clear() must only happen while the account is held with a
+// StateDeltas accessor, as for any other write.
+class LazyStorageDeltas
+{
+    std::unique_ptr<StorageDeltas> map_{};
+
+    static StorageDeltas const &empty_map()
+    {
+        static StorageDeltas const empty{};
+        return empty;
+    }
+
+    StorageDeltas const &map() const
+    {
+        return map_ ? *map_ : empty_map();
+    }
+
+public:
+    using accessor = StorageDeltas::accessor;
+    using const_accessor = StorageDeltas::const_accessor;
+    using const_iterator = StorageDeltas::const_iterator;
+
+    LazyStorageDeltas() = default;
+
+    LazyStorageDeltas(
+        std::initializer_list<StorageDeltas::value_type> const init)
+    {
+        if (init.size() != 0) {
+            map_ = std::make_unique<StorageDeltas>(init);
+        }
+    }
+
+    LazyStorageDeltas(StorageDeltas const &storage)
+    {
+        if (!storage.empty()) {
+            map_ = std::make_unique<StorageDeltas>(storage);
+        }
+    }
+
+    LazyStorageDeltas(StorageDeltas &&storage)
+    {
+        if (!storage.empty()) {
+            map_ = std::make_unique<StorageDeltas>(std::move(storage));
+        }
+    }
+
+    LazyStorageDeltas(LazyStorageDeltas const &other)
+        : LazyStorageDeltas(other.map())
+    {
+    }
+
+    LazyStorageDeltas(LazyStorageDeltas &&) = default;
+
+    LazyStorageDeltas &operator=(LazyStorageDeltas const &other)
+    {
+        if (this != &other) {
+            *this = LazyStorageDeltas(other);
+        }
+        return *this;
+    }
+
+    LazyStorageDeltas &operator=(LazyStorageDeltas &&) = default;
+
+    bool find(const_accessor &it, bytes32_t const &key) const
+    {
+        return map_ && map_->find(it, key);
+    }
+
+    bool find(accessor &it, bytes32_t const &key)
+    {
+        return map_ && map_->find(it, key);
+    }
+
+    template <class... Args>
+    bool emplace(Args &&...args)
+    {
+        if (!map_) {
+            map_ = std::make_unique<StorageDeltas>();
+        }
+        return map_->emplace(std::forward<Args>(args)...);
+    }
+
+    void clear()
+    {
+        map_.reset();
+    }
+
+    bool empty() const
+    {
+        return !map_ || map_->empty();
+    }
+
+    size_t size() const
+    {
+        return map_ ? map_->size() : 0;
+    }
+
+    const_iterator begin() const
+    {
+        return map().begin();
+    }
+
+    const_iterator end() const
+    {
+        return map().end();
+    }
+
+    const_iterator cbegin() const
+    {
+        return map().cbegin();
+    }
+
+    const_iterator cend() const
+    {
+        return map().cend();
+    }
+};
+
+static_assert(sizeof(LazyStorageDeltas) == 8);
+static_assert(alignof(LazyStorageDeltas) == 8);
+
 struct StateDelta
 {
     AccountDelta account;
-    StorageDeltas storage{};
+    LazyStorageDeltas storage{};
 };
 
-static_assert(sizeof(StateDelta) == 752);
+static_assert(sizeof(StateDelta) == 184);
 static_assert(alignof(StateDelta) == 8);
 
 using StateDeltas = oneapi::tbb::concurrent_hash_map<Address, StateDelta>;
@@ -0,0 +1,160 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/core/bytes.hpp>
+#include <category/core/config.hpp>
+#include <category/core/fiber/priority_pool.hpp>
+#include <category/execution/ethereum/core/account.hpp>
+#include <category/execution/ethereum/core/address.hpp>
+#include <category/execution/ethereum/core/block.hpp>
+#include <category/execution/ethereum/core/transaction.hpp>
+#include <category/execution/ethereum/core/withdrawal.hpp>
+#include <category/execution/ethereum/state2/block_state.hpp>
+#include <category/execution/ethereum/state2/state_prefetcher.hpp>
+
+#include <boost/fiber/future/promise.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+MONAD_NAMESPACE_BEGIN
+
+StatePrefetcher::StatePrefetcher(
+    BlockState &block_state, fiber::PriorityPool &priority_pool,
+    size_t const budget)
+    : block_state_{block_state}
+    , priority_pool_{priority_pool}
+    , budget_{budget}
+{
+}
+
+StatePrefetcher::~StatePrefetcher()
+{
+    wait();
+}
+
+void StatePrefetcher::add(
+    std::vector<Request> &requests, Address const &address,
+    std::vector<bytes32_t> const &keys)
+{
+    if (budget_ == 0) {
+        return;
+    }
+    auto const [it, inserted] = seen_.try_emplace(address);
+    if (inserted) {
+        --budget_;
+        ++n_prefetched_;
+    }
+    std::vector<bytes32_t> new_keys;
+    for (auto const &key : keys) {
+        if (budget_ == 0) {
+            break;
+        }
+        if (it->second.insert(key).second) {
+            new_keys.push_back(key);
+            --budget_;
+            ++n_prefetched_;
+        }
+    }
+    if (inserted || !new_keys.empty()) {
+        requests.push_back({address, std::move(new_keys)});
+    }
+}
+
+void StatePrefetcher::submit(
+    uint64_t const priority, std::vector<Request> &requests)
+{
+    for (auto &request : requests) {
+        auto const promise = std::make_shared<boost::fibers::promise<void>>();
+        pending_.push_back(promise->get_future());
+        priority_pool_.submit(
+            priority,
+            [&block_state = block_state_,
+             request = std::move(request),
+             promise = promise] {
+                auto const account = block_state.read_account(request.address);
+                if (account.has_value()) {
+                    if (account->code_hash != NULL_HASH) {
+                        block_state.read_code(account->code_hash);
+                    }
+                    for (auto const &key : request.keys) {
+                        block_state.read_storage(
+                            request.address, account->incarnation, key);
+                    }
+                }
+                promise->set_value();
+            });
+    }
+    requests.clear();
+}
+
+void StatePrefetcher::prefetch(Block const &block)
+{
+    std::vector<Request> requests;
+
+    add(requests, block.header.beneficiary);
+    submit(0, requests);
+
+    for (uint64_t i = 0; i < block.transactions.size(); ++i) {
+        auto const &tx = block.transactions[i];
+        if (tx.to.has_value()) {
+            add(requests, tx.to.value());
+        }
+        for (auto const &ae : tx.access_list) {
+            add(requests, ae.a, ae.keys);
+        }
+        submit(i, requests);
+    }
+
+    if (block.withdrawals.has_value()) {
+        for (auto const &withdrawal : block.withdrawals.value()) {
+            add(requests, withdrawal.recipient);
+        }
+        submit(block.transactions.size(), requests);
+    }
+}
+
+void StatePrefetcher::prefetch(
+    std::vector<Address> const &senders,
+    std::vector<std::vector<std::optional<Address>>> const &authorities)
+{
+    std::vector<Request> requests;
+
+    for (uint64_t i = 0; i < senders.size(); ++i) {
+        add(requests, senders[i]);
+        if (i < authorities.size()) {
+            for (auto const &authority : authorities[i]) {
+                if (authority.has_value()) {
+                    add(requests, authority.value());
+                }
+            }
+        }
+        submit(i, requests);
+    }
+}
+
+void StatePrefetcher::wait()
+{
+    for (auto &future : pending_) {
+        future.wait();
+    }
+    pending_.clear();
+}
+
+MONAD_NAMESPACE_END
@@ -0,0 +1,93 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <category/core/bytes.hpp>
+#include <category/core/config.hpp>
+#include <category/core/fiber/priority_pool.hpp>
+#include <category/execution/ethereum/core/address.hpp>
+
+#include <ankerl/unordered_dense.h>
+#include <boost/fiber/future/future.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+MONAD_NAMESPACE_BEGIN
+
+class BlockState;
+struct Block;
+
+// PREFETCH
+// Reads the accounts and storage slots a block is known to touch into the
+// block state ahead of its transactions: beneficiary, withdrawal recipients,
+// recipients, EIP-2930 access lists, senders and EIP-7702 authorities. Reads
+// run as fibers on the priority pool, so database lookups are issued
+// concurrently instead of one at a time on first touch. At most `budget`
+// accounts and slots are read per block.
+//
+// The block state must not be committed before wait() returns, which the
+// destructor also does.
+class StatePrefetcher final
+{
+    BlockState &block_state_;
+    fiber::PriorityPool &priority_pool_;
+    size_t budget_;
+    ankerl::unordered_dense::segmented_map<
+        Address, ankerl::unordered_dense::segmented_set<bytes32_t>>
+        seen_{};
+    std::vector<boost::fibers::future<void>> pending_{};
+    uint64_t n_prefetched_{0};
+
+    struct Request
+    {
+        Address address;
+        std::vector<bytes32_t> keys;
+    };
+
+    void add(
+        std::vector<Request> &, Address const &,
+        std::vector<bytes32_t> const &keys = {});
+
+    void submit(uint64_t priority, std::vector<Request> &);
+
+public:
+    StatePrefetcher(BlockState &, fiber::PriorityPool &, size_t budget);
+
+    StatePrefetcher(StatePrefetcher const &) = delete;
+    StatePrefetcher &operator=(StatePrefetcher const &) = delete;
+
+    ~StatePrefetcher();
+
+    // everything known from the block body
+    void prefetch(Block const &);
+
+    // everything known once senders and authorities are recovered
+    void prefetch(
+        std::vector<Address> const &senders,
+        std::vector<std::vector<std::optional<Address>>> const &authorities);
+
+    void wait();
+
+    uint64_t num_prefetched() const
+    {
+        return n_prefetched_;
+    }
+};
+
+MONAD_NAMESPACE_END
@@ -15,12 +15,16 @@
 
 #include <test_resource_data.h>
 
+#include <category/async/util.hpp>
 #include <category/core/assert.h>
 #include <category/core/blake3.hpp>
 #include <category/core/byte_string.hpp>
 #include <category/core/bytes.hpp>
+#include <category/core/bytes_hash_compare.hpp>
+#include <category/core/fiber/priority_pool.hpp>
 #include <category/execution/ethereum/core/account.hpp>
 #include <category/execution/ethereum/core/address.hpp>
+#include <category/execution/ethereum/core/block.hpp>
 #include <category/execution/ethereum/core/fmt/bytes_fmt.hpp>
 #include <category/execution/ethereum/core/fmt/int_fmt.hpp>
 #include <category/execution/ethereum/db/db.hpp>
@@ -28,7 +32,9 @@
 #include <category/execution/ethereum/db/trie_db.hpp>
 #include <category/execution/ethereum/db/util.hpp>
 #include <category/execution/ethereum/state2/block_state.hpp>
+#include <category/execution/ethereum/state2/single_flight.hpp>
 #include <category/execution/ethereum/state2/state_deltas.hpp>
+#include <category/execution/ethereum/state2/state_prefetcher.hpp>
 #include <category/execution/ethereum/state3/state.hpp>
 #include <category/mpt/db.hpp>
 #include <category/mpt/nibbles_view.hpp>
@@ -38,6 +44,9 @@
 #include <category/vm/evm/traits.hpp>
 #include <category/vm/vm.hpp>
 
+#include <boost/fiber/fiber.hpp>
+#include <boost/fiber/operations.hpp>
+
 #include <evmc/evmc.h>
 #include <evmc/evmc.hpp>
 
@@ -48,6 +57,7 @@
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <filesystem>
 #include <map>
 #include <memory>
 #include <optional>
@@ -56,6 +66,8 @@
 #include <string>
 #include <utility>
 
+#include <unistd.h>
+
 using namespace monad;
 using namespace monad::test;
 
@@ -1111,6 +1123,41 @@ TYPED_TEST(StateTest, can_merge_same_account_different_storage)
     bs.merge(cs);
 }
 
+TYPED_TEST(StateTest, merged_writes_visible_to_later_reads)
+{
+    BlockState bs{this->tdb, this->vm};
+
+    commit_sequential(
+        this->tdb,
+        StateDeltas{
+            {b,
+             StateDelta{
+                 .account = {std::nullopt, Account{.balance = 40'000}},
+                 .storage = {{key1, {bytes32_t{}, value1}}}}}},
+        Code{},
+        BlockHeader{});
+
+    // the writes of each transaction are applied by the reads of the next
+    // one, or all at once
+    bytes32_t const values[] = {value2, value3, null};
+    for (uint64_t i = 1; i <= 3; ++i) {
+        State as{bs, Incarnation{1, i}};
+        as.add_to_balance(b, 1);
+        as.set_storage(b, key1, values[i - 1]);
+        EXPECT_TRUE(bs.can_merge(as));
+        bs.merge(as);
+        if (i == 2) {
+            bs.apply_merged();
+        }
+    }
+
+    EXPECT_EQ(bs.read_account(b).value().balance, 40'003);
+
+    State cs{bs, Incarnation{1, 4}};
+    EXPECT_EQ(cs.get_storage(b, key1), null);
+    EXPECT_TRUE(bs.can_merge(cs));
+}
+
 TYPED_TEST(StateTest, cant_merge_colliding_storage)
 {
     BlockState bs{this->tdb, this->vm};
@@ -1136,6 +1183,9 @@ TYPED_TEST(StateTest, cant_merge_colliding_storage)
     EXPECT_TRUE(bs.can_merge(as));
     bs.merge(as);
     EXPECT_FALSE(bs.can_merge(cs));
+    ASSERT_TRUE(cs.merge_conflict().has_value());
+    EXPECT_EQ(cs.merge_conflict()->address, b);
+    EXPECT_EQ(cs.merge_conflict()->key, key1);
 
     // Need to rerun txn 1 - get new changset
     {
@@ -1147,6 +1197,315 @@ TYPED_TEST(StateTest, cant_merge_colliding_storage)
     }
 }
 
+TYPED_TEST(StateTest, can_merge_unobserved_nonce)
+{
+    BlockState bs{this->tdb, this->vm};
+
+    commit_sequential(
+        this->tdb,
+        StateDeltas{
+            {b,
+             StateDelta{
+                 .account =
+                     {std::nullopt, Account{.balance = 40'000, .nonce = 1}},
+                 .storage = {{key1, {bytes32_t{}, value1}}}}}},
+        Code{},
+        BlockHeader{});
+
+    State as{bs, Incarnation{1, 1}};
+    as.set_nonce(b, as.get_nonce(b) + 1);
+
+    // only the code hash and storage of b are observed
+    State cs{bs, Incarnation{1, 2}};
+    EXPECT_EQ(cs.get_code_hash(b), NULL_HASH);
+    EXPECT_EQ(cs.set_storage(b, key2, value2), EVMC_STORAGE_ADDED);
+
+    EXPECT_TRUE(bs.can_merge(as));
+    bs.merge(as);
+    EXPECT_TRUE(bs.can_merge(cs));
+    EXPECT_FALSE(cs.merge_conflict().has_value());
+    bs.merge(cs);
+
+    auto const account = bs.read_account(b);
+    ASSERT_TRUE(account.has_value());
+    EXPECT_EQ(account->nonce, 2);
+    EXPECT_EQ(account->balance, 40'000u);
+    EXPECT_EQ(bs.read_storage(b, Incarnation{0, 0}, key2), value2);
+}
+
+TYPED_TEST(StateTest, cant_merge_observed_nonce)
+{
+    BlockState bs{this->tdb, this->vm};
+
+    commit_sequential(
+        this->tdb,
+        StateDeltas{
+            {b,
+             StateDelta{
+                 .account =
+                     {std::nullopt, Account{.balance = 40'000, .nonce = 1}}}}},
+        Code{},
+        BlockHeader{});
+
+    State as{bs, Incarnation{1, 1}};
+    as.set_nonce(b, as.get_nonce(b) + 1);
+
+    State cs{bs, Incarnation{1, 2}};
+    EXPECT_EQ(cs.get_nonce(b), 1);
+    cs.set_code(b, code1);
+
+    EXPECT_TRUE(bs.can_merge(as));
+    bs.merge(as);
+    EXPECT_FALSE(bs.can_merge(cs));
+    ASSERT_TRUE(cs.merge_conflict().has_value());
+    EXPECT_EQ(cs.merge_conflict()->address, b);
+    EXPECT_FALSE(cs.merge_conflict()->key.has_value());
+}
+
+TYPED_TEST(StateTest, can_merge_blind_balance_additions)
+{
+    BlockState bs{this->tdb, this->vm};
+
+    commit_sequential(
+        this->tdb,
+        StateDeltas{
+            {b,
+             StateDelta{
+                 .account = {std::nullopt, Account{.balance = 40'000}}}}},
+        Code{},
+        BlockHeader{});
+
+    State as{bs, Incarnation{1, 1}};
+    as.add_to_balance(b, 1'000);
+
+    State cs{bs, Incarnation{1, 2}};
+    cs.add_to_balance(b, 2'000);
+
+    EXPECT_TRUE(bs.can_merge(as));
+    bs.merge(as);
+    EXPECT_TRUE(bs.can_merge(cs));
+    bs.merge(cs);
+
+    auto const account = bs.read_account(b);
+    ASSERT_TRUE(account.has_value());
+    EXPECT_EQ(account->balance, 43'000u);
+}
+
+TYPED_TEST(StateTest, cant_merge_observed_balance_addition)
+{
+    BlockState bs{this->tdb, this->vm};
+
+    commit_sequential(
+        this->tdb,
+        StateDeltas{
+            {b,
+             StateDelta{
+                 .account = {std::nullopt, Account{.balance = 40'000}}}}},
+        Code{},
+        BlockHeader{});
+
+    State as{bs, Incarnation{1, 1}};
+    as.add_to_balance(b, 1'000);
+
+    State cs{bs, Incarnation{1, 2}};
+    EXPECT_EQ(cs.get_balance(b), bytes32_t{40'000});
+    cs.add_to_balance(b, 2'000);
+
+    EXPECT_TRUE(bs.can_merge(as));
+    bs.merge(as);
+    EXPECT_FALSE(bs.can_merge(cs));
+    ASSERT_TRUE(cs.merge_conflict().has_value());
+    EXPECT_EQ(cs.merge_conflict()->address, b);
+}
+
+TYPED_TEST(StateTest, read_published_writes)
+{
+    BlockState bs{this->tdb, this->vm};
+
+    commit_sequential(
+        this->tdb,
+        StateDeltas{
+            {a,
+             StateDelta{
+                 .account = {std::nullopt, Account{.balance = 10'000}}}},
+            {b,
+             StateDelta{
+                 .account =
+                     {std::nullopt, Account{.balance = 40'000, .nonce = 1}},
+                 .storage = {{key1, {bytes32_t{}, value1}}}}}},
+        Code{},
+        BlockHeader{});
+
+    State as{bs, Incarnation{1, 1}};
+    as.subtract_from_balance(a, 1'000);
+    EXPECT_EQ(as.set_storage(b, key1, value2), EVMC_STORAGE_MODIFIED);
+    as.set_nonce(b, 2);
+    bs.publish(as, {a});
+
+    // later transactions see the pending writes, except for unsettled
+    // accounts
+    State cs{bs, Incarnation{1, 2}};
+    EXPECT_EQ(cs.get_storage(b, key1), value2);
+    EXPECT_EQ(cs.get_nonce(b), 2);
+    EXPECT_EQ(cs.get_balance(a), bytes32_t{10'000});
+
+    // earlier transactions do not
+    State ds{bs, Incarnation{1, 1}};
+    EXPECT_EQ(ds.get_storage(b, key1), value1);
+    EXPECT_EQ(ds.get_nonce(b), 1);
+
+    EXPECT_TRUE(bs.can_merge(as));
+    bs.merge(as);
+    EXPECT_FALSE(bs.can_merge(cs));
+    ASSERT_TRUE(cs.merge_conflict().has_value());
+    EXPECT_EQ(cs.merge_conflict()->address, a);
+}
+
+TYPED_TEST(StateTest, cant_merge_retired_writes)
+{
+    BlockState bs{this->tdb, this->vm};
+
+    commit_sequential(
+        this->tdb,
+        StateDeltas{
+            {b,
+             StateDelta{
+                 .account = {std::nullopt, Account{.balance = 40'000}},
+                 .storage = {{key1, {bytes32_t{}, value1}}}}}},
+        Code{},
+        BlockHeader{});
+
+    State as{bs, Incarnation{1, 1}};
+    EXPECT_EQ(as.set_storage(b, key1, value2), EVMC_STORAGE_MODIFIED);
+    bs.publish(as, {});
+
+    State cs{bs, Incarnation{1, 2}};
+    EXPECT_EQ(cs.get_storage(b, key1), value2);
+
+    // the writer did not merge
+    bs.retire(1);
+    EXPECT_FALSE(bs.can_merge(cs));
+    ASSERT_TRUE(cs.merge_conflict().has_value());
+    EXPECT_EQ(cs.merge_conflict()->address, b);
+    EXPECT_EQ(cs.merge_conflict()->key, key1);
+
+    State retry{bs, Incarnation{1, 2}};
+    EXPECT_EQ(retry.get_storage(b, key1), value1);
+    EXPECT_TRUE(bs.can_merge(retry));
+}
+
+TYPED_TEST(StateTest, prefetch)
+{
+    BlockState bs{this->tdb, this->vm};
+
+    commit_sequential(
+        this->tdb,
+        StateDeltas{
+            {a,
+             StateDelta{
+                 .account = {std::nullopt, Account{.balance = 10'000}},
+                 .storage =
+                     {{key1, {bytes32_t{}, value1}},
+                      {key2, {bytes32_t{}, value2}}}}}},
+        Code{},
+        BlockHeader{});
+
+    fiber::PriorityPool pool{1, 1};
+    Block block{.header = {.beneficiary = c}};
+    block.transactions.push_back(
+        Transaction{.to = a, .access_list = {{a, {key1, key2}}}});
+    {
+        // beneficiary, recipient and the first slot fit the budget
+        StatePrefetcher prefetcher{bs, pool, 3};
+        prefetcher.prefetch(block);
+        prefetcher.prefetch({b}, {});
+        prefetcher.wait();
+        EXPECT_EQ(prefetcher.num_prefetched(), 3u);
+    }
+
+    State s{bs, Incarnation{1, 1}};
+    EXPECT_TRUE(s.account_exists(a));
+    EXPECT_EQ(s.get_storage(a, key1), value1);
+    EXPECT_EQ(bs.num_read_hits(), 2u);
+    EXPECT_EQ(bs.num_read_misses(), 0u);
+    EXPECT_EQ(s.get_storage(a, key2), value2);
+    EXPECT_EQ(bs.num_read_misses(), 1u);
+    EXPECT_FALSE(s.account_exists(b));
+    EXPECT_EQ(bs.num_read_misses(), 2u);
+}
+
+TEST(LazyStorageDeltas, allocate_on_first_slot)
+{
+    LazyStorageDeltas storage{};
+    EXPECT_TRUE(storage.empty());
+    EXPECT_EQ(storage.begin(), storage.end());
+    {
+        LazyStorageDeltas::const_accessor it{};
+        EXPECT_FALSE(storage.find(it, key1));
+    }
+
+    EXPECT_TRUE(storage.emplace(key1, std::make_pair(bytes32_t{}, value1)));
+    EXPECT_EQ(storage.size(), 1u);
+
+    LazyStorageDeltas copy{storage};
+    {
+        LazyStorageDeltas::accessor it{};
+        ASSERT_TRUE(copy.find(it, key1));
+        it->second.second = value2;
+    }
+    {
+        LazyStorageDeltas::const_accessor it{};
+        ASSERT_TRUE(storage.find(it, key1));
+        EXPECT_EQ(it->second.second, value1);
+    }
+
+    storage.clear();
+    EXPECT_TRUE(storage.empty());
+    EXPECT_EQ(copy.size(), 1u);
+}
+
+TEST(SingleFlight, coalesce_concurrent_reads)
+{
+    SingleFlight<Address, int, BytesHashCompare<Address>> reads;
+    unsigned n_reads = 0;
+    bool waiting = false;
+    int r1 = 0;
+    int r2 = 0;
+
+    // the first read is in flight until the second reader waits on it
+    boost::fibers::fiber f1{[&] {
+        r1 = reads.read(a, [&] {
+            ++n_reads;
+            while (!waiting) {
+                boost::this_fiber::yield();
+            }
+            return 42;
+        });
+    }};
+    boost::fibers::fiber f2{[&] {
+        waiting = true;
+        r2 = reads.read(a, [&] {
+            ++n_reads;
+            return 0;
+        });
+    }};
+    f1.join();
+    f2.join();
+    EXPECT_EQ(r1, 42);
+    EXPECT_EQ(r2, 42);
+    EXPECT_EQ(n_reads, 1u);
+    EXPECT_EQ(reads.num_coalesced(), 1u);
+
+    // nothing in flight anymore
+    auto const r3 = reads.read(a, [&] {
+        ++n_reads;
+        return 7;
+    });
+    EXPECT_EQ(r3, 7);
+    EXPECT_EQ(n_reads, 2u);
+    EXPECT_EQ(reads.num_coalesced(), 1u);
+}
+
 TYPED_TEST(StateTest, merge_txn0_and_txn1)
 {
     BlockState bs{this->tdb, this->vm};
@@ -1650,6 +2009,115 @@ TEST_F(OnDiskTrieDbFixture, undecided_proposals)
     EXPECT_EQ(state_root_round_131, to_bytes(data_131.value()));
 }
 
+TEST_F(OnDiskTrieDbFixture, hot_set)
+{
+    std::filesystem::path const path = [] {
+        std::filesystem::path path =
+            MONAD_ASYNC_NAMESPACE::working_temporary_directory() /
+            "monad_hot_set_test_XXXXXX";
+        int const fd = ::mkstemp((char *)path.native().data());
+        MONAD_ASSERT(fd != -1);
+        ::close(fd);
+        return path;
+    }();
+    fiber::PriorityPool pool{1, 4};
+    load_header(this->db, BlockHeader{.number = 9});
+    {
+        DbCache db_cache(this->tdb);
+        // empty file
+        EXPECT_FALSE(db_cache.warm_up(path, pool, this->vm).has_value());
+        db_cache.set_hot_set_autosave(path, 1);
+        std::unique_ptr<StateDeltas> state_deltas{new StateDeltas{
+            {a,
+             StateDelta{
+                 .account =
+                     {std::nullopt,
+                      Account{.balance = 10'000, .code_hash = code_hash1}}}},
+            {b,
+             StateDelta{
+                 .account = {std::nullopt, Account{.balance = 20'000}},
+                 .storage =
+                     {{key1, {bytes32_t{}, value1}},
+                      {key2, {bytes32_t{}, value2}}}}}}};
+        db_cache.set_block_and_prefix(9);
+        db_cache.commit(
+            std::move(state_deltas),
+            Code{{code_hash1, icode1}},
+            bytes32_t{10},
+            BlockHeader{.number = 10});
+        // the save at shutdown follows the background save of finalize
+        db_cache.finalize(10, bytes32_t{10});
+        db_cache.save_hot_set(path);
+    }
+    for (auto const &entry :
+         std::filesystem::directory_iterator{path.parent_path()}) {
+        EXPECT_FALSE(entry.path().filename().string().starts_with(
+            path.filename().string() + ".tmp"));
+    }
+
+    DbCache db_cache(this->tdb);
+    db_cache.set_block_and_prefix(10);
+    auto const stats = db_cache.warm_up(path, pool, this->vm);
+    ASSERT_TRUE(stats.has_value());
+    EXPECT_EQ(stats->accounts, 2);
+    EXPECT_EQ(stats->slots, 2);
+    EXPECT_EQ(stats->code, 1);
+    EXPECT_TRUE(this->vm.find_varcode(code_hash1).has_value());
+    EXPECT_EQ(db_cache.read_account(a).value().balance, uint256_t{10'000});
+    EXPECT_EQ(db_cache.read_storage(b, Incarnation{0, 0}, key2), value2);
+
+    // a truncated hot set is ignored
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    EXPECT_FALSE(db_cache.warm_up(path, pool, this->vm).has_value());
+    std::filesystem::remove(path);
+}
+
+TEST_F(OnDiskTrieDbFixture, cache_budget)
+{
+    // a few hundred entries per cache
+    constexpr size_t budget = size_t{1} << 17;
+    constexpr uint64_t n_accounts = 800;
+
+    load_header(this->db, BlockHeader{.number = 9});
+    DbCache db_cache(this->tdb, budget);
+    EXPECT_EQ(db_cache.account_budget(), budget / 2);
+
+    // every block evicts accounts of itself or of the previous block, which
+    // are read back right after, so only the account cache has ghost hits
+    size_t account_budget = db_cache.account_budget();
+    for (uint64_t n = 10; n < 100; ++n) {
+        std::unique_ptr<StateDeltas> state_deltas{new StateDeltas{}};
+        for (uint64_t i = 0; i < n_accounts; ++i) {
+            state_deltas->insert(std::make_pair(
+                Address{n * n_accounts + i},
+                StateDelta{
+                    .account = {std::nullopt, Account{.balance = n}}}));
+        }
+        db_cache.set_block_and_prefix(n - 1);
+        db_cache.commit(
+            std::move(state_deltas),
+            Code{},
+            bytes32_t{n},
+            BlockHeader{.number = n});
+        db_cache.finalize(n, bytes32_t{n});
+        db_cache.set_block_and_prefix(n);
+        for (uint64_t m = n == 10 ? n : n - 1; m <= n; ++m) {
+            for (uint64_t i = 0; i < n_accounts; ++i) {
+                EXPECT_EQ(
+                    db_cache.read_account(Address{m * n_accounts + i})
+                        .value()
+                        .balance,
+                    m);
+            }
+        }
+        EXPECT_GE(db_cache.account_budget(), account_budget);
+        account_budget = db_cache.account_budget();
+    }
+
+    // the storage cache keeps its floor
+    EXPECT_EQ(db_cache.account_budget(), budget - budget / 16);
+}
+
 namespace
 {
     using Dist = std::uniform_int_distribution<uint64_t>;
@@ -104,12 +104,24 @@ public:
 // RELAXED MERGE
 // track the min original balance needed at start of transaction and if the
 // original and current balances can be adjusted
+//
+// READ SET
+// track which fields of the original account were observed by execution. A
+// field that was never observed can be rebased onto the block state at merge
+// time instead of failing the merge.
 class OriginalAccountState final : public AccountState
 {
     bool validate_exact_balance_{false};
     uint256_t min_balance_{0};
+    uint8_t observed_{0};
 
 public:
+    static constexpr uint8_t OBSERVED_NONCE = 1 << 0;
+    static constexpr uint8_t OBSERVED_BALANCE = 1 << 1;
+    static constexpr uint8_t OBSERVED_CODE_HASH = 1 << 2;
+    static constexpr uint8_t OBSERVED_ALL =
+        OBSERVED_NONCE | OBSERVED_BALANCE | OBSERVED_CODE_HASH;
+
     explicit OriginalAccountState(std::optional<Account> &&account)
         : AccountState(std::move(account))
     {
@@ -133,12 +145,24 @@ public:
     void set_validate_exact_balance()
     {
         validate_exact_balance_ = true;
+        observed_ |= OBSERVED_BALANCE;
+    }
+
+    [[nodiscard]] bool is_observed(uint8_t const fields) const
+    {
+        return (observed_ & fields) != 0;
+    }
+
+    void observe(uint8_t const fields)
+    {
+        observed_ |= fields;
     }
 
     void set_min_balance(uint256_t const &value)
     {
         MONAD_ASSERT(account_.has_value());
         MONAD_ASSERT(account_->balance >= value);
+        observed_ |= OBSERVED_BALANCE;
         if (value > min_balance_) {
             min_balance_ = value;
         }
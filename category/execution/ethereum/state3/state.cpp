@@ -57,7 +57,8 @@ OriginalAccountState &State::original_account_state(Address const &address)
     auto it = original_.find(address);
     if (it == original_.end()) {
         // block state
-        auto const account = block_state_.read_account(address);
+        auto const account =
+            block_state_.read_account(address, incarnation_.get_tx());
         it = original_.try_emplace(address, account).first;
     }
     return it->second;
@@ -91,15 +92,34 @@ std::optional<Account> &State::current_account(Address const &address)
     return current_account_state(address).account_;
 }
 
+std::optional<Account> const &
+State::observe_account(Address const &address, uint8_t const fields)
+{
+    auto &original_state = original_account_state(address);
+    original_state.observe(fields);
+    auto const it = current_.find(address);
+    if (it != current_.end()) {
+        return it->second.recent().account_;
+    }
+    return original_state.account_;
+}
+
 State::State(
     BlockState &block_state, Incarnation const incarnation,
     bool const relaxed_validation)
     : block_state_{block_state}
     , incarnation_{incarnation}
+    , current_{&arena_}
+    , code_{&arena_}
     , relaxed_validation_{relaxed_validation}
 {
 }
 
+Incarnation State::incarnation() const
+{
+    return incarnation_;
+}
+
 State::Map<Address, OriginalAccountState> const &State::original() const
 {
     return original_;
@@ -110,12 +130,18 @@ State::Map<Address, OriginalAccountState> &State::original()
     return original_;
 }
 
-State::Map<Address, VersionStack<AccountState>> const &State::current() const
+State::ArenaMap<Address, VersionStack<AccountState>> const &
+State::current() const
 {
     return current_;
 }
 
-State::Map<bytes32_t, vm::SharedVarcode> const &State::code() const
+State::ArenaMap<Address, VersionStack<AccountState>> &State::current()
+{
+    return current_;
+}
+
+State::ArenaMap<bytes32_t, vm::SharedVarcode> const &State::code() const
 {
     return code_;
 }
@@ -167,7 +193,7 @@ vm::VM &State::vm()
 
 std::optional<Account> const &State::recent_account(Address const &address)
 {
-    return recent_account_state(address).account_;
+    return observe_account(address, OriginalAccountState::OBSERVED_ALL);
 }
 
 void State::set_original_nonce(Address const &address, uint64_t const nonce)
@@ -182,17 +208,20 @@ void State::set_original_nonce(Address const &address, uint64_t const nonce)
 
 bool State::account_exists(Address const &address)
 {
-    return recent_account(address).has_value();
+    // existence is always validated at merge
+    return recent_account_state(address).account_.has_value();
 }
 
 bool State::account_is_dead(Address const &address)
 {
-    return is_dead(recent_account(address));
+    return is_dead(
+        observe_account(address, OriginalAccountState::OBSERVED_ALL));
 }
 
 uint64_t State::get_nonce(Address const &address)
 {
-    auto const &account = recent_account(address);
+    auto const &account =
+        observe_account(address, OriginalAccountState::OBSERVED_NONCE);
     if (MONAD_LIKELY(account.has_value())) {
         return account.value().nonce;
     }
@@ -201,7 +230,7 @@ uint64_t State::get_nonce(Address const &address)
 
 bytes32_t State::get_balance(Address const &address)
 {
-    auto const &account = recent_account(address);
+    auto const &account = recent_account_state(address).account_;
     original_account_state(address).set_validate_exact_balance();
     if (MONAD_LIKELY(account.has_value())) {
         return intx::be::store<bytes32_t>(account.value().balance);
@@ -211,7 +240,8 @@ bytes32_t State::get_balance(Address const &address)
 
 bytes32_t State::get_code_hash(Address const &address)
 {
-    auto const &account = recent_account(address);
+    auto const &account =
+        observe_account(address, OriginalAccountState::OBSERVED_CODE_HASH);
     if (MONAD_LIKELY(account.has_value())) {
         return account.value().code_hash;
     }
@@ -231,7 +261,10 @@ bytes32_t State::get_storage(Address const &address, bytes32_t const &key)
         auto it3 = storage.find(key);
         if (it3 == storage.end()) {
             bytes32_t const value = block_state_.read_storage(
-                address, account.value().incarnation, key);
+                address,
+                account.value().incarnation,
+                key,
+                incarnation_.get_tx());
             it3 = storage.try_emplace(key, value).first;
         }
         return it3->second;
@@ -257,7 +290,10 @@ bytes32_t State::get_storage(Address const &address, bytes32_t const &key)
         auto it3 = original_storage.find(key);
         if (it3 == original_storage.end()) {
             bytes32_t const value = block_state_.read_storage(
-                address, account.value().incarnation, key);
+                address,
+                account.value().incarnation,
+                key,
+                incarnation_.get_tx());
             it3 = original_storage.try_emplace(key, value).first;
         }
         return it3->second;
@@ -298,6 +334,9 @@ void State::add_to_balance(Address const &address, uint256_t const &delta)
             account.value().balance,
         "balance overflow");
 
+    // COMMUTATIVE BALANCE
+    // a blind addition does not observe the balance, so it commutes with
+    // balance changes merged before this transaction
     account.value().balance += delta;
     account_state.touch();
 }
@@ -312,6 +351,8 @@ void State::subtract_from_balance(
     }
 
     MONAD_ASSERT(delta <= account.value().balance);
+    original_account_state(address).observe(
+        OriginalAccountState::OBSERVED_BALANCE);
 
     account.value().balance -= delta;
     account_state.touch();
@@ -337,8 +378,8 @@ evmc_storage_status State::set_storage(
         auto it = storage.find(key);
         if (it == storage.end()) {
             Incarnation const incarnation = account_state.account_->incarnation;
-            bytes32_t const value =
-                block_state_.read_storage(address, incarnation, key);
+            bytes32_t const value = block_state_.read_storage(
+                address, incarnation, key, incarnation_.get_tx());
             it = storage.try_emplace(key, value).first;
         }
         original_value = it->second;
@@ -441,6 +482,8 @@ void State::destruct_touched_dead()
         if (MONAD_LIKELY(!account_state.is_touched())) {
             continue;
         }
+        original_account_state(it.first)
+            .observe(OriginalAccountState::OBSERVED_ALL);
         auto &account = account_state.account_;
         if (is_dead(account)) {
             account.reset();
@@ -461,7 +504,8 @@ vm::SharedVarcode State::read_code(bytes32_t const &code_hash)
 
 vm::SharedVarcode State::get_code(Address const &address)
 {
-    auto const &account = recent_account(address);
+    auto const &account =
+        observe_account(address, OriginalAccountState::OBSERVED_CODE_HASH);
     if (MONAD_UNLIKELY(!account.has_value())) {
         return block_state_.read_code(NULL_HASH);
     }
@@ -470,7 +514,8 @@ vm::SharedVarcode State::get_code(Address const &address)
 
 size_t State::get_code_size(Address const &address)
 {
-    auto const &account = recent_account(address);
+    auto const &account =
+        observe_account(address, OriginalAccountState::OBSERVED_CODE_HASH);
     if (MONAD_UNLIKELY(!account.has_value())) {
         return 0;
     }
@@ -492,7 +537,8 @@ size_t State::copy_code(
     Address const &address, size_t const offset, uint8_t *const buffer,
     size_t const buffer_size)
 {
-    auto const &account = recent_account(address);
+    auto const &account =
+        observe_account(address, OriginalAccountState::OBSERVED_CODE_HASH);
     if (MONAD_UNLIKELY(!account.has_value())) {
         return 0;
     }
@@ -533,6 +579,8 @@ void State::set_code(Address const &address, byte_string_view const code)
 
 void State::create_contract(Address const &address)
 {
+    original_account_state(address).observe(
+        OriginalAccountState::OBSERVED_ALL);
     auto &account = current_account(address);
     if (MONAD_UNLIKELY(account.has_value())) {
         // EIP-684
@@ -592,6 +640,10 @@ void State::set_to_state_incarnation(Address const &address)
 // RELAXED MERGE
 // if original and current can be adjusted to satisfy min balance, adjust
 // both values for merge
+//
+// READ SET
+// nonce and code hash mismatches are rebased onto `actual` if execution
+// never observed them
 bool State::try_fix_account_mismatch(
     Address const &address, OriginalAccountState &original_state,
     std::optional<Account> const &actual)
@@ -604,28 +656,40 @@ bool State::try_fix_account_mismatch(
     if (is_dead(actual)) {
         return false;
     }
-    if (original->code_hash != actual->code_hash) {
-        return false;
-    }
     if (original->incarnation != actual->incarnation) {
         return false;
     }
-    if (original->nonce != actual->nonce) {
-        return false;
-    }
-    MONAD_ASSERT(original->balance != actual->balance);
-    // is relaxed merge disabled
-    if (!relaxed_validation_) {
+    bool const nonce_mismatch = original->nonce != actual->nonce;
+    if (nonce_mismatch &&
+        original_state.is_observed(OriginalAccountState::OBSERVED_NONCE)) {
         return false;
     }
-    if (original_state.validate_exact_balance()) {
+    bool const code_hash_mismatch = original->code_hash != actual->code_hash;
+    if (code_hash_mismatch &&
+        original_state.is_observed(OriginalAccountState::OBSERVED_CODE_HASH)) {
         return false;
     }
-    // original balance does not meet min required
-    if (actual->balance < original_state.min_balance()) {
-        return false;
+    bool const balance_mismatch = original->balance != actual->balance;
+    MONAD_ASSERT(nonce_mismatch || code_hash_mismatch || balance_mismatch);
+    // COMMUTATIVE BALANCE
+    // a balance that was never observed was only added to, so the additions
+    // are rebased onto the merged balance below whether or not relaxed merge
+    // is enabled
+    if (balance_mismatch &&
+        original_state.is_observed(OriginalAccountState::OBSERVED_BALANCE)) {
+        // is relaxed merge disabled
+        if (!relaxed_validation_) {
+            return false;
+        }
+        if (original_state.validate_exact_balance()) {
+            return false;
+        }
+        // original balance does not meet min required
+        if (actual->balance < original_state.min_balance()) {
+            return false;
+        }
     }
-    // adjust balances
+    // adjust current
     auto it = current_.find(address);
     if (it != current_.end()) {
         MONAD_ASSERT(it->second.size() == 1);
@@ -634,17 +698,38 @@ bool State::try_fix_account_mismatch(
         if (!recent) {
             return false;
         }
-        if (actual->balance > original->balance) {
-            recent->balance += actual->balance - original->balance;
+        if (balance_mismatch) {
+            if (actual->balance > original->balance) {
+                recent->balance += actual->balance - original->balance;
+            }
+            else {
+                MONAD_ASSERT(
+                    recent->balance >= (original->balance - actual->balance));
+                recent->balance -= original->balance - actual->balance;
+            }
+        }
+        // unobserved fields that were not written take the merged value,
+        // blind writes are kept since this transaction is ordered later
+        if (nonce_mismatch && recent->nonce == original->nonce) {
+            recent->nonce = actual->nonce;
         }
-        else {
-            MONAD_ASSERT(
-                recent->balance >= (original->balance - actual->balance));
-            recent->balance -= original->balance - actual->balance;
+        if (code_hash_mismatch && recent->code_hash == original->code_hash) {
+            recent->code_hash = actual->code_hash;
         }
     }
-    original->balance = actual->balance;
+    original = actual;
     return true;
 }
 
+void State::set_merge_conflict(
+    Address const &address, std::optional<bytes32_t> const &key)
+{
+    merge_conflict_ = MergeConflict{.address = address, .key = key};
+}
+
+std::optional<MergeConflict> const &State::merge_conflict() const
+{
+    return merge_conflict_;
+}
+
 MONAD_NAMESPACE_END
@@ -18,6 +18,7 @@
 #include <category/core/byte_string.hpp>
 #include <category/core/bytes.hpp>
 #include <category/core/config.hpp>
+#include <category/core/mem/arena_resource.hpp>
 #include <category/execution/ethereum/core/account.hpp>
 #include <category/execution/ethereum/core/address.hpp>
 #include <category/execution/ethereum/core/receipt.hpp>
@@ -40,27 +41,42 @@ MONAD_NAMESPACE_BEGIN
 
 class BlockState;
 
+struct MergeConflict
+{
+    Address address;
+    std::optional<bytes32_t> key;
+};
+
 class State
 {
     template <typename K, typename V>
     using Map = ankerl::unordered_dense::segmented_map<K, V>;
 
+    // ARENA
+    // allocated from the arena of this state, released all at once with it
+    template <typename K, typename V>
+    using ArenaMap = ankerl::unordered_dense::pmr::segmented_map<K, V>;
+
     BlockState &block_state_;
 
     Incarnation const incarnation_;
 
+    ArenaResource arena_{};
+
     Map<Address, OriginalAccountState> original_{};
 
-    Map<Address, VersionStack<AccountState>> current_{};
+    ArenaMap<Address, VersionStack<AccountState>> current_;
 
     VersionStack<std::vector<Receipt::Log>> logs_{{}};
 
-    Map<bytes32_t, vm::SharedVarcode> code_{};
+    ArenaMap<bytes32_t, vm::SharedVarcode> code_;
 
     unsigned version_{0};
 
     bool const relaxed_validation_{false};
 
+    std::optional<MergeConflict> merge_conflict_{};
+
 public:
     OriginalAccountState &original_account_state(Address const &);
 
@@ -71,6 +87,11 @@ private:
 
     std::optional<Account> &current_account(Address const &);
 
+    // READ SET
+    // recent account, recording that `fields` of the original were observed
+    std::optional<Account> const &
+    observe_account(Address const &, uint8_t fields);
+
 public:
     State(BlockState &, Incarnation, bool relaxed_validation = false);
 
@@ -79,13 +100,17 @@ public:
     State &operator=(State &&) = delete;
     State &operator=(State const &) = delete;
 
+    Incarnation incarnation() const;
+
     Map<Address, OriginalAccountState> const &original() const;
 
     Map<Address, OriginalAccountState> &original();
 
-    Map<Address, VersionStack<AccountState>> const &current() const;
+    ArenaMap<Address, VersionStack<AccountState>> const &current() const;
 
-    Map<bytes32_t, vm::SharedVarcode> const &code() const;
+    ArenaMap<Address, VersionStack<AccountState>> &current();
+
+    ArenaMap<bytes32_t, vm::SharedVarcode> const &code() const;
 
     void push();
 
@@ -197,9 +222,21 @@ public:
     // RELAXED MERGE
     // if original and current can be adjusted to satisfy min balance, adjust
     // both values for merge
+    //
+    // READ SET
+    // nonce, code hash and balance mismatches are rebased onto `actual` if
+    // execution never observed them. An unobserved balance was only added
+    // to, so the additions commute with merged balance changes.
     bool try_fix_account_mismatch(
         Address const &, OriginalAccountState &,
         std::optional<Account> const &actual);
+
+    ////////////////////////////////////////
+
+    void set_merge_conflict(
+        Address const &, std::optional<bytes32_t> const &key = std::nullopt);
+
+    std::optional<MergeConflict> const &merge_conflict() const;
 };
 
 MONAD_NAMESPACE_END
@@ -18,80 +18,179 @@
 #include <category/core/assert.h>
 #include <category/core/config.hpp>
 
-#include <deque>
+#include <cstddef>
+#include <memory>
+#include <new>
 #include <utility>
+#include <vector>
 
 MONAD_NAMESPACE_BEGIN
 
-template <class T>
+// Versions of a value by call depth. Most values are only ever modified at
+// one or two depths, so the first `N` versions are stored inline and only
+// deeper call trees spill to the heap.
+template <class T, size_t N = 2>
 class VersionStack
 {
-    std::deque<std::pair<unsigned, T>> stack_{};
+    static_assert(N > 0);
+
+    using Entry = std::pair<unsigned, T>;
+
+    alignas(Entry) std::byte inline_[N * sizeof(Entry)];
+    size_t n_inline_{0};
+    std::vector<Entry> spill_{};
+
+    void *slot(size_t const i)
+    {
+        return inline_ + i * sizeof(Entry);
+    }
+
+    Entry *inline_entry(size_t const i)
+    {
+        return std::launder(reinterpret_cast<Entry *>(inline_) + i);
+    }
+
+    Entry const *inline_entry(size_t const i) const
+    {
+        return std::launder(reinterpret_cast<Entry const *>(inline_) + i);
+    }
+
+    Entry &at(size_t const i)
+    {
+        return i < N ? *inline_entry(i) : spill_[i - N];
+    }
+
+    Entry const &back() const
+    {
+        return spill_.empty() ? *inline_entry(n_inline_ - 1) : spill_.back();
+    }
+
+    Entry &back()
+    {
+        return spill_.empty() ? *inline_entry(n_inline_ - 1) : spill_.back();
+    }
+
+    template <class... Args>
+    void emplace_back(Args &&...args)
+    {
+        if (n_inline_ < N) {
+            ::new (slot(n_inline_)) Entry(std::forward<Args>(args)...);
+            ++n_inline_;
+        }
+        else {
+            spill_.emplace_back(std::forward<Args>(args)...);
+        }
+    }
+
+    void pop_back()
+    {
+        if (!spill_.empty()) {
+            spill_.pop_back();
+        }
+        else {
+            std::destroy_at(inline_entry(--n_inline_));
+        }
+    }
+
+    void clear()
+    {
+        spill_.clear();
+        while (n_inline_) {
+            std::destroy_at(inline_entry(--n_inline_));
+        }
+    }
+
+    void move_from(VersionStack &other)
+    {
+        for (size_t i = 0; i < other.n_inline_; ++i) {
+            ::new (slot(i)) Entry(std::move(*other.inline_entry(i)));
+        }
+        n_inline_ = other.n_inline_;
+        spill_ = std::move(other.spill_);
+        other.clear();
+    }
 
 public:
     VersionStack(T value, unsigned version = 0)
     {
-        stack_.emplace_back(version, std::move(value));
+        emplace_back(version, std::move(value));
+    }
+
+    VersionStack(VersionStack &&other)
+    {
+        move_from(other);
     }
 
-    VersionStack(VersionStack &&) = default;
     VersionStack(VersionStack const &) = delete;
-    VersionStack &operator=(VersionStack &&) = default;
+
+    VersionStack &operator=(VersionStack &&other)
+    {
+        if (this != &other) {
+            clear();
+            move_from(other);
+        }
+        return *this;
+    }
+
     VersionStack &operator=(VersionStack const &) = delete;
 
+    ~VersionStack()
+    {
+        clear();
+    }
+
     size_t size() const
     {
-        return stack_.size();
+        return n_inline_ + spill_.size();
     }
 
     unsigned version() const
     {
-        MONAD_ASSERT(stack_.size());
+        MONAD_ASSERT(size());
 
-        return stack_.back().first;
+        return back().first;
     }
 
     T const &recent() const
     {
-        MONAD_ASSERT(stack_.size());
+        MONAD_ASSERT(size());
 
-        return stack_.back().second;
+        return back().second;
     }
 
     T &recent()
     {
-        MONAD_ASSERT(stack_.size());
+        MONAD_ASSERT(size());
 
-        return stack_.back().second;
+        return back().second;
     }
 
     T &current(unsigned const version)
     {
-        MONAD_ASSERT(stack_.size());
+        MONAD_ASSERT(size());
 
-        if (version > stack_.back().first) {
-            T value = stack_.back().second;
-            stack_.emplace_back(version, std::move(value));
+        if (version > back().first) {
+            T value = back().second;
+            emplace_back(version, std::move(value));
         }
 
-        return stack_.back().second;
+        return back().second;
     }
 
     void pop_accept(unsigned const version)
     {
         MONAD_ASSERT(version);
 
-        auto const size = stack_.size();
+        auto const size = this->size();
         MONAD_ASSERT(size);
 
-        if (version == stack_.back().first) {
-            if (size > 1 &&
-                stack_[size - 2].first + 1 == stack_[size - 1].first) {
-                stack_[size - 2].second = std::move(stack_[size - 1].second);
-                stack_.pop_back();
+        if (version == back().first) {
+            if (size > 1 && at(size - 2).first + 1 == at(size - 1).first) {
+                at(size - 2).second = std::move(at(size - 1).second);
+                pop_back();
             }
             else {
-                stack_.back().first = version - 1;
+                back().first = version - 1;
             }
         }
     }
@@ -100,14 +199,13 @@ public:
     {
         MONAD_ASSERT(version);
 
-        auto const size = stack_.size();
-        MONAD_ASSERT(size);
+        MONAD_ASSERT(size());
 
-        if (version == stack_.back().first) {
-            stack_.pop_back();
+        if (version == back().first) {
+            pop_back();
         }
 
-        return stack_.empty();
+        return size() == 0;
     }
 };
 
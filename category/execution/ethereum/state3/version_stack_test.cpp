@@ -0,0 +1,96 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/execution/ethereum/state3/version_stack.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+using namespace monad;
+
+TEST(VersionStack, accept_and_reject)
+{
+    VersionStack<int> stack{1};
+    EXPECT_EQ(stack.size(), 1u);
+    EXPECT_EQ(stack.version(), 0u);
+
+    stack.current(1) = 2;
+    EXPECT_EQ(stack.size(), 2u);
+    EXPECT_EQ(stack.recent(), 2);
+
+    // untouched at version 2
+    stack.pop_accept(2);
+    EXPECT_EQ(stack.size(), 2u);
+    EXPECT_EQ(stack.version(), 1u);
+
+    stack.pop_accept(1);
+    EXPECT_EQ(stack.size(), 1u);
+    EXPECT_EQ(stack.version(), 0u);
+    EXPECT_EQ(stack.recent(), 2);
+
+    stack.current(1) = 3;
+    EXPECT_FALSE(stack.pop_reject(1));
+    EXPECT_EQ(stack.recent(), 2);
+
+    VersionStack<int> created{4, 1};
+    EXPECT_TRUE(created.pop_reject(1));
+    EXPECT_EQ(created.size(), 0u);
+}
+
+TEST(VersionStack, spill_deep_calls)
+{
+    VersionStack<std::string, 2> stack{"0"};
+    for (unsigned version = 1; version <= 5; ++version) {
+        stack.current(version) = std::to_string(version);
+    }
+    EXPECT_EQ(stack.size(), 6u);
+    EXPECT_EQ(stack.recent(), "5");
+
+    VersionStack<std::string, 2> moved{std::move(stack)};
+    EXPECT_EQ(stack.size(), 0u);
+    EXPECT_EQ(moved.size(), 6u);
+
+    EXPECT_FALSE(moved.pop_reject(5));
+    moved.pop_accept(4);
+    EXPECT_EQ(moved.size(), 4u);
+    EXPECT_EQ(moved.recent(), "4");
+    moved.pop_accept(3);
+    moved.pop_accept(2);
+    EXPECT_EQ(moved.size(), 2u);
+    EXPECT_EQ(moved.version(), 1u);
+    EXPECT_EQ(moved.recent(), "4");
+
+    stack = std::move(moved);
+    EXPECT_EQ(stack.size(), 2u);
+    stack.pop_accept(1);
+    EXPECT_EQ(stack.size(), 1u);
+    EXPECT_EQ(stack.recent(), "4");
+}
+
+TEST(VersionStack, destroys_inline_entries)
+{
+    auto const value = std::make_shared<int>(0);
+    {
+        VersionStack<std::shared_ptr<int>> stack{value};
+        stack.current(1);
+        stack.current(2);
+        stack.current(3);
+        EXPECT_EQ(value.use_count(), 5);
+    }
+    EXPECT_EQ(value.use_count(), 1);
+}
@@ -13,14 +13,17 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
+#include <category/async/detail/scope_polyfill.hpp>
 #include <category/core/byte_string.hpp>
 #include <category/core/bytes.hpp>
+#include <category/core/fiber/priority_pool.hpp>
 #include <category/core/int.hpp>
 #include <category/execution/ethereum/chain/ethereum_mainnet.hpp>
 #include <category/execution/ethereum/core/account.hpp>
 #include <category/execution/ethereum/core/block.hpp>
 #include <category/execution/ethereum/core/transaction.hpp>
 #include <category/execution/ethereum/dao.hpp>
+#include <category/execution/ethereum/execute_block.hpp>
 #include <category/execution/ethereum/validate_block.hpp>
 #include <category/execution/ethereum/validate_transaction.hpp>
 #include <category/vm/evm/traits.hpp>
@@ -35,6 +38,8 @@
 #include <cstdint>
 #include <limits>
 #include <optional>
+#include <utility>
+#include <vector>
 
 using namespace monad;
 
@@ -333,3 +338,37 @@ TEST(Validation, invalid_nonce)
     auto const result = static_validate_header<EvmTraits<EVMC_PARIS>>(header);
     EXPECT_EQ(result.error(), BlockError::InvalidNonce);
 }
+
+namespace
+{
+    // mirrors the validation at the start of the monad runloop's
+    // propose_block, which owns the block whose senders are being recovered
+    template <Traits traits>
+    Result<void>
+    validate_recovering_block(Block const block, SenderRecovery &recovery)
+    {
+        auto const wait_for_recovery =
+            make_scope_exit([&recovery]() noexcept { recovery.wait(); });
+        BOOST_OUTCOME_TRY(static_validate_block<traits>(block));
+        (void)recovery.senders();
+        return success();
+    }
+}
+
+TEST(Validation, invalid_block_with_pending_sender_recovery)
+{
+    // the block is dropped on the early return while its transactions are
+    // still being recovered, ASan reports a recovery reading them after
+    Block block{.header = {.gas_limit = 1000}};
+    for (uint64_t i = 0; i < 4096; ++i) {
+        block.transactions.push_back(Transaction{
+            .sc = {.r = i + 1, .s = i + 2}, .nonce = i, .gas_limit = 21'000});
+    }
+    fiber::PriorityPool pool{4, 16};
+    SenderRecovery recovery{block.transactions, pool};
+
+    auto const result = validate_recovering_block<EvmTraits<EVMC_SHANGHAI>>(
+        std::move(block), recovery);
+    EXPECT_EQ(result.error(), BlockError::InvalidGasLimit);
+    EXPECT_EQ(recovery.senders().size(), 4096);
+}
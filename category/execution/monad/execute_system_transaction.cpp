@@ -19,6 +19,7 @@
 #include <category/execution/ethereum/chain/chain.hpp>
 #include <category/execution/ethereum/core/contract/abi_signatures.hpp>
 #include <category/execution/ethereum/core/transaction.hpp>
+#include <category/execution/ethereum/execute_transaction.hpp>
 #include <category/execution/ethereum/metrics/block_metrics.hpp>
 #include <category/execution/ethereum/state2/block_state.hpp>
 #include <category/execution/ethereum/state3/state.hpp>
@@ -115,8 +116,8 @@ Result<Receipt> ExecuteSystemTransaction<traits>::operator()()
             block_state_.merge(state);
             return receipt;
         }
+        record_retry(block_metrics_, i_, state.merge_conflict());
     }
-    block_metrics_.inc_retries();
     {
         TRACE_TXN_EVENT(StartRetry);
 
@@ -50,10 +50,15 @@ bool dipped_into_reserve(
 
     uint256_t const gas_fees =
         uint256_t{tx.gas_limit} * gas_price(rev, tx, base_fee_per_gas);
-    auto const &orig = state.original();
+    auto &orig = state.original();
     for (auto const &[addr, stack] : state.current()) {
         MONAD_ASSERT(orig.contains(addr));
-        std::optional<Account> const &orig_account = orig.at(addr).account_;
+        // READ SET
+        // the original balance only matters for accounts that were debited,
+        // which observes the balance already
+        auto &orig_state = orig.at(addr);
+        orig_state.observe(OriginalAccountState::OBSERVED_CODE_HASH);
+        std::optional<Account> const &orig_account = orig_state.account_;
         bytes32_t const orig_code_hash = orig_account.has_value()
                                              ? orig_account.value().code_hash
                                              : NULL_HASH;
@@ -15,7 +15,12 @@
 
 #pragma once
 
+#include <category/core/assert.h>
+#include <category/core/bytes.hpp>
+#include <category/core/bytes_hash_compare.hpp>
 #include <category/core/config.hpp>
+#include <category/execution/ethereum/core/account.hpp>
+#include <category/execution/ethereum/core/address.hpp>
 #include <category/execution/ethereum/state2/state_deltas.hpp>
 #include <category/vm/vm.hpp>
 
@@ -23,25 +28,141 @@
 
 #include <quill/Quill.h>
 
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 MONAD_NAMESPACE_BEGIN
 
+// FROZEN PROPOSAL
+// The state of a committed proposal is read-only for the rest of its life.
+// It is frozen into immutable arrays that reads search without locks: the
+// accounts sorted by address, and the storage slots of all accounts packed
+// in one array, sorted by key within each account. Only the values after
+// the block are kept, which is all that reads and finalization need.
 class ProposalState
 {
-    std::unique_ptr<StateDeltas> state_;
+public:
+    struct FrozenAccount
+    {
+        Address address;
+        std::optional<Account> account;
+        // range of the slots of the account in the storage array
+        uint32_t storage_begin;
+        uint32_t storage_end;
+    };
+
+    using FrozenSlot = std::pair<bytes32_t, bytes32_t>;
+
+private:
+    // PROPOSAL FILTER
+    // Blocked Bloom filter of the addresses in the state: each address sets
+    // 3 bits of one word. Storage reads go through the account of the slot
+    // too, so a read of an address that is not in the filter skips the
+    // proposal without a search.
+    static constexpr size_t FILTER_BITS_PER_KEY = 16;
+
+    std::vector<FrozenAccount> accounts_;
+    std::vector<FrozenSlot> storage_;
     uint64_t parent_block_;
     bytes32_t parent_id_;
+    std::vector<uint64_t> filter_;
+
+    static uint64_t filter_hash(Address const &address)
+    {
+        return BytesHashCompare<Address>{}.hash(address);
+    }
+
+    static uint64_t filter_mask(uint64_t const hash)
+    {
+        return (uint64_t{1} << ((hash >> 40) & 63)) |
+               (uint64_t{1} << ((hash >> 46) & 63)) |
+               (uint64_t{1} << ((hash >> 52) & 63));
+    }
+
+    void freeze(StateDeltas const &state)
+    {
+        std::vector<std::pair<Address, StateDelta const *>> sorted;
+        sorted.reserve(state.size());
+        for (auto it = state.cbegin(); it != state.cend(); ++it) {
+            sorted.emplace_back(it->first, &it->second);
+        }
+        std::sort(
+            sorted.begin(), sorted.end(), [](auto const &a, auto const &b) {
+                return a.first < b.first;
+            });
+        accounts_.reserve(sorted.size());
+        for (auto const &[address, delta] : sorted) {
+            auto const &storage = delta->storage;
+            MONAD_ASSERT(storage_.size() + storage.size() <= UINT32_MAX);
+            auto const begin = static_cast<uint32_t>(storage_.size());
+            for (auto it = storage.cbegin(); it != storage.cend(); ++it) {
+                storage_.emplace_back(it->first, it->second.second);
+            }
+            std::sort(
+                storage_.begin() + begin,
+                storage_.end(),
+                [](FrozenSlot const &a, FrozenSlot const &b) {
+                    return a.first < b.first;
+                });
+            accounts_.push_back(
+                {.address = address,
+                 .account = delta->account.second,
+                 .storage_begin = begin,
+                 .storage_end = static_cast<uint32_t>(storage_.size())});
+        }
+        storage_.shrink_to_fit();
+    }
+
+    FrozenAccount const *find(Address const &address) const
+    {
+        if (!may_contain(address)) {
+            return nullptr;
+        }
+        auto const it = std::lower_bound(
+            accounts_.begin(),
+            accounts_.end(),
+            address,
+            [](FrozenAccount const &a, Address const &b) {
+                return a.address < b;
+            });
+        if (it == accounts_.end() || it->address != address) {
+            return nullptr;
+        }
+        return &*it;
+    }
 
 public:
+    // freezes `state`, which is released
     ProposalState(
         std::unique_ptr<StateDeltas> state, uint64_t const parent_block_number,
         bytes32_t const &parent_id)
-        : state_(std::move(state))
-        , parent_block_(parent_block_number)
+        : parent_block_(parent_block_number)
         , parent_id_(parent_id)
+        , filter_(
+              std::bit_ceil(state->size() * FILTER_BITS_PER_KEY / 64 + 1))
+    {
+        freeze(*state);
+        for (auto const &frozen : accounts_) {
+            uint64_t const hash = filter_hash(frozen.address);
+            filter_[hash & (filter_.size() - 1)] |= filter_mask(hash);
+        }
+    }
+
+    // false if the state has no delta of `address`
+    bool may_contain(Address const &address) const
     {
+        uint64_t const hash = filter_hash(address);
+        uint64_t const mask = filter_mask(hash);
+        return (filter_[hash & (filter_.size() - 1)] & mask) == mask;
     }
 
     std::pair<uint64_t, bytes32_t> parent_info() const
@@ -49,39 +170,53 @@ public:
         return {parent_block_, parent_id_};
     }
 
-    StateDeltas const &state() const
+    // sorted by address
+    std::span<FrozenAccount const> accounts() const
+    {
+        return accounts_;
+    }
+
+    // sorted by key
+    std::span<FrozenSlot const> storage(FrozenAccount const &frozen) const
     {
-        return *state_;
+        return std::span{storage_}.subspan(
+            frozen.storage_begin, frozen.storage_end - frozen.storage_begin);
     }
 
     bool try_read_account(
         Address const &address, std::optional<Account> &result) const
     {
-        StateDeltas::const_accessor it{};
-        if (state_->find(it, address)) {
-            result = it->second.account.second;
-            return true;
+        FrozenAccount const *const frozen = find(address);
+        if (!frozen) {
+            return false;
         }
-        return false;
+        result = frozen->account;
+        return true;
     }
 
     bool try_read_storage(
         Address const &address, Incarnation const incarnation,
         bytes32_t const &key, bytes32_t &result) const
     {
-        StateDeltas::const_accessor it{};
-        if (!state_->find(it, address)) {
+        FrozenAccount const *const frozen = find(address);
+        if (!frozen) {
             return false;
         }
-        auto const &account = it->second.account.second;
+        auto const &account = frozen->account;
         if (!account || incarnation != account->incarnation) {
             result = {};
             return true;
         }
-        auto const &storage = it->second.storage;
-        StorageDeltas::const_accessor it2{};
-        if (storage.find(it2, key)) {
-            result = it2->second.second;
+        auto const storage = this->storage(*frozen);
+        auto const it = std::lower_bound(
+            storage.begin(),
+            storage.end(),
+            key,
+            [](FrozenSlot const &a, bytes32_t const &b) {
+                return a.first < b;
+            });
+        if (it != storage.end() && it->first == key) {
+            result = it->second;
             return true;
         }
         return false;
@@ -107,6 +242,7 @@ class Proposals
     using ProposalMap = std::map<Key, Value, ProposalMapComparator>;
 
     static constexpr size_t MAX_PROPOSAL_MAP_SIZE = 100;
+    static constexpr size_t DEPTH_LIMIT = 5;
 
     ProposalMap proposal_map_{};
     uint64_t block_{0};
@@ -114,6 +250,15 @@ class Proposals
     uint64_t finalized_block_{0};
     bytes32_t finalized_block_id_{};
 
+    // PROPOSAL FILTER
+    // Ancestors of the current block that reads go through, from the block
+    // back to the finalized block, resolved whenever the block or the map
+    // changes instead of once per ancestor per read. `broken_` is the
+    // ancestor at or below the finalized block that ended the chain, if any.
+    std::vector<ProposalState const *> chain_{};
+    bool chain_truncated_{false};
+    std::optional<Key> broken_{};
+
 public:
     bool try_read_account(
         Address const &address, std::optional<Account> &result,
@@ -141,6 +286,7 @@ public:
     {
         block_ = block_number;
         block_id_ = block_id;
+        update_chain();
     }
 
     void commit(
@@ -160,6 +306,7 @@ public:
                 .second == true);
         block_ = block_number;
         block_id_ = block_id;
+        update_chain();
     }
 
     std::unique_ptr<ProposalState>
@@ -173,6 +320,7 @@ public:
                 "Finalizing truncated proposal of block_id {}. Clear LRU "
                 "caches.",
                 block_id);
+            update_chain();
             return {};
         }
         std::unique_ptr<ProposalState> ps = std::move(it->second);
@@ -182,6 +330,7 @@ public:
              it2->first.first <= finalized_block_;) {
             it2 = proposal_map_.erase(it2);
         }
+        update_chain();
         return ps;
     }
 
@@ -189,45 +338,54 @@ private:
     template <class Func>
     bool try_read(Func const try_read_fn, bool &truncated) const
     {
-        constexpr int DEPTH_LIMIT = 5;
-        int depth = 1;
+        for (ProposalState const *const ps : chain_) {
+            if (try_read_fn(*ps)) {
+                return true;
+            }
+        }
+        MONAD_ASSERT_PRINTF(
+            !broken_.has_value(),
+            "block_number %lu is not greater than last finalized block "
+            "%lu. block_id = %s, block_ %lu, block_id_ %s, "
+            "finalized_block_id_ = %s, depth = %zu",
+            broken_->first,
+            finalized_block_,
+            evmc::hex(to_byte_string_view(broken_->second.bytes)).c_str(),
+            block_,
+            evmc::hex(to_byte_string_view(block_id_.bytes)).c_str(),
+            evmc::hex(to_byte_string_view(finalized_block_id_.bytes)).c_str(),
+            chain_.size() + 1);
+        truncated = chain_truncated_;
+        return false;
+    }
+
+    void update_chain()
+    {
+        chain_.clear();
+        chain_truncated_ = false;
+        broken_.reset();
         bytes32_t block_id = block_id_;
         uint64_t block_number = block_;
-        while (true) {
-            if (block_id == finalized_block_id_) {
-                break;
+        while (block_id != finalized_block_id_) {
+            if (block_number <= finalized_block_) {
+                broken_ = std::make_pair(block_number, block_id);
+                return;
             }
-            MONAD_ASSERT_PRINTF(
-                block_number > finalized_block_,
-                "block_number %lu is not greater than last finalized block "
-                "%lu. block_id = %s, block_ %lu, block_id_ %s, "
-                "finalized_block_id_ = %s, depth = %d",
-                block_number,
-                finalized_block_,
-                evmc::hex(to_byte_string_view(block_id.bytes)).c_str(),
-                block_,
-                evmc::hex(to_byte_string_view(block_id_.bytes)).c_str(),
-                evmc::hex(to_byte_string_view(finalized_block_id_.bytes))
-                    .c_str(),
-                depth);
             auto const it =
                 proposal_map_.find(std::make_pair(block_number, block_id));
             if (it == proposal_map_.end()) {
-                truncated = true;
-                break;
+                chain_truncated_ = true;
+                return;
             }
-            ProposalState const *ps = it->second.get();
+            ProposalState const *const ps = it->second.get();
             MONAD_ASSERT(ps);
-            if (try_read_fn(*ps)) {
-                return true;
-            }
-            if (++depth > DEPTH_LIMIT) {
-                truncated = true;
-                break;
+            chain_.push_back(ps);
+            if (chain_.size() == DEPTH_LIMIT) {
+                chain_truncated_ = true;
+                return;
             }
             std::tie(block_number, block_id) = ps->parent_info();
         }
-        return false;
     }
 
     void truncate_proposal_map()
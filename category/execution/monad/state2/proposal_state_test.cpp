@@ -0,0 +1,213 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#include <category/core/bytes.hpp>
+#include <category/execution/ethereum/core/account.hpp>
+#include <category/execution/ethereum/core/address.hpp>
+#include <category/execution/ethereum/state2/state_deltas.hpp>
+#include <category/execution/monad/state2/proposal_state.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <optional>
+
+using namespace monad;
+
+namespace
+{
+    // state of `n` accounts with one slot each, from address `first`
+    std::unique_ptr<StateDeltas>
+    make_state(uint64_t const first, uint64_t const n)
+    {
+        auto state = std::make_unique<StateDeltas>();
+        for (uint64_t i = first; i < first + n; ++i) {
+            state->emplace(
+                Address{i},
+                StateDelta{
+                    .account = {std::nullopt, Account{.balance = i}},
+                    .storage = {{bytes32_t{i}, {bytes32_t{}, bytes32_t{i}}}}});
+        }
+        return state;
+    }
+
+    // chain of `depth` proposals on top of the finalized block 0, proposal
+    // `b` holds the accounts [1000 * b, 1000 * b + n)
+    void commit_chain(Proposals &proposals, uint64_t const depth, uint64_t n)
+    {
+        proposals.set_block_and_prefix(0, bytes32_t{});
+        for (uint64_t b = 1; b <= depth; ++b) {
+            proposals.commit(make_state(1000 * b, n), b, bytes32_t{b});
+        }
+    }
+}
+
+TEST(ProposalState, filter)
+{
+    ProposalState const ps{make_state(1, 1000), 0, bytes32_t{}};
+    for (uint64_t i = 1; i <= 1000; ++i) {
+        EXPECT_TRUE(ps.may_contain(Address{i}));
+    }
+    unsigned false_positives = 0;
+    for (uint64_t i = 10'000; i < 20'000; ++i) {
+        false_positives += ps.may_contain(Address{i});
+    }
+    EXPECT_LT(false_positives, 500);
+
+    ProposalState const empty{std::make_unique<StateDeltas>(), 0, {}};
+    std::optional<Account> account;
+    EXPECT_FALSE(empty.try_read_account(Address{1}, account));
+}
+
+TEST(ProposalState, frozen)
+{
+    auto state = make_state(1, 100);
+    {
+        StateDeltas::accessor it{};
+        ASSERT_TRUE(state->find(it, Address{7}));
+        for (uint64_t k = 100; k > 0; --k) {
+            it->second.storage.emplace(
+                bytes32_t{k}, StorageDelta{bytes32_t{}, bytes32_t{k + 1}});
+        }
+    }
+    state->emplace(
+        Address{200}, StateDelta{.account = {Account{}, std::nullopt}});
+    ProposalState const ps{std::move(state), 0, bytes32_t{}};
+
+    auto const accounts = ps.accounts();
+    ASSERT_EQ(accounts.size(), 101);
+    EXPECT_TRUE(std::is_sorted(
+        accounts.begin(), accounts.end(), [](auto const &a, auto const &b) {
+            return a.address < b.address;
+        }));
+    for (auto const &frozen : accounts) {
+        auto const storage = ps.storage(frozen);
+        EXPECT_TRUE(std::is_sorted(storage.begin(), storage.end()));
+        if (frozen.address == Address{7}) {
+            EXPECT_EQ(storage.size(), 100);
+        }
+    }
+
+    bytes32_t value;
+    for (uint64_t k = 1; k <= 100; ++k) {
+        ASSERT_TRUE(ps.try_read_storage(
+            Address{7}, Incarnation{0, 0}, bytes32_t{k}, value));
+        EXPECT_EQ(value, k == 7 ? bytes32_t{7} : bytes32_t{k + 1});
+    }
+    EXPECT_FALSE(ps.try_read_storage(
+        Address{7}, Incarnation{0, 0}, bytes32_t{101}, value));
+
+    // slots of another incarnation or of a deleted account are zero
+    ASSERT_TRUE(ps.try_read_storage(
+        Address{7}, Incarnation{1, 0}, bytes32_t{1}, value));
+    EXPECT_EQ(value, bytes32_t{});
+    ASSERT_TRUE(ps.try_read_storage(
+        Address{200}, Incarnation{0, 0}, bytes32_t{1}, value));
+    EXPECT_EQ(value, bytes32_t{});
+    std::optional<Account> account;
+    ASSERT_TRUE(ps.try_read_account(Address{200}, account));
+    EXPECT_FALSE(account.has_value());
+}
+
+TEST(Proposals, read_through_ancestors)
+{
+    Proposals proposals;
+    commit_chain(proposals, 3, 10);
+
+    std::optional<Account> account;
+    bool truncated = false;
+    ASSERT_TRUE(proposals.try_read_account(Address{1001}, account, truncated));
+    EXPECT_EQ(account.value().balance, 1001);
+    ASSERT_TRUE(proposals.try_read_account(Address{3009}, account, truncated));
+    EXPECT_EQ(account.value().balance, 3009);
+    EXPECT_FALSE(proposals.try_read_account(Address{7}, account, truncated));
+    EXPECT_FALSE(truncated);
+
+    bytes32_t value;
+    ASSERT_TRUE(proposals.try_read_storage(
+        Address{2001}, Incarnation{0, 0}, bytes32_t{2001}, value, truncated));
+    EXPECT_EQ(value, bytes32_t{2001});
+    EXPECT_FALSE(proposals.try_read_storage(
+        Address{2001}, Incarnation{0, 0}, bytes32_t{7}, value, truncated));
+    EXPECT_FALSE(truncated);
+
+    // a fork of block 2 does not see the other block 2
+    proposals.set_block_and_prefix(1, bytes32_t{1});
+    proposals.commit(make_state(5000, 1), 2, bytes32_t{22});
+    EXPECT_FALSE(proposals.try_read_account(Address{2001}, account, truncated));
+    EXPECT_TRUE(proposals.try_read_account(Address{5000}, account, truncated));
+    EXPECT_TRUE(proposals.try_read_account(Address{1001}, account, truncated));
+
+    // finalized proposals are read from the caches
+    EXPECT_NE(proposals.finalize(1, bytes32_t{1}), nullptr);
+    EXPECT_FALSE(proposals.try_read_account(Address{1001}, account, truncated));
+    EXPECT_FALSE(truncated);
+}
+
+TEST(Proposals, depth_limit)
+{
+    Proposals proposals;
+    commit_chain(proposals, 7, 1);
+
+    std::optional<Account> account;
+    bool truncated = false;
+    EXPECT_TRUE(proposals.try_read_account(Address{3000}, account, truncated));
+    EXPECT_FALSE(truncated);
+    EXPECT_FALSE(proposals.try_read_account(Address{2000}, account, truncated));
+    EXPECT_TRUE(truncated);
+}
+
+TEST(Proposals, DISABLED_benchmark)
+{
+    constexpr uint64_t n_accounts = 2'000;
+    constexpr unsigned n_reads = 1'000'000;
+
+    for (uint64_t depth = 1; depth <= 10; ++depth) {
+        Proposals proposals;
+        commit_chain(proposals, depth, n_accounts);
+
+        std::optional<Account> account;
+        bool truncated = false;
+        unsigned found = 0;
+        auto const begin = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < n_reads; ++i) {
+            // cold reads, missing in every proposal
+            found += proposals.try_read_account(
+                Address{1'000'000 + i}, account, truncated);
+        }
+        auto const cold = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < n_reads; ++i) {
+            // reads of the oldest proposal in reach
+            uint64_t const b = depth < 5 ? 1 : depth - 4;
+            found += proposals.try_read_account(
+                Address{1000 * b + i % n_accounts}, account, truncated);
+        }
+        auto const end = std::chrono::steady_clock::now();
+        EXPECT_EQ(found, n_reads);
+
+        auto const ns = [](auto const elapsed) {
+            return static_cast<double>(
+                       std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           elapsed)
+                           .count()) /
+                   n_reads;
+        };
+        std::cout << "depth=" << depth << " cold=" << ns(cold - begin)
+                  << "ns oldest=" << ns(end - cold) << "ns" << std::endl;
+    }
+}
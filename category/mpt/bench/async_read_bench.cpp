@@ -35,8 +35,10 @@
 #include <filesystem>
 #include <limits>
 #include <list>
+#include <mutex>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #include <signal.h>
 #include <stdint.h>
@@ -100,6 +102,9 @@ int main(int argc, char *const argv[])
     uint32_t runtime_seconds = std::numeric_limits<uint32_t>::max();
     unsigned update_delay_ms = 500;
     uint64_t cache_size = 1 * 1024 * 1024;
+    std::vector<unsigned> read_threads_sweep;
+    unsigned num_find_clients = 64;
+    uint32_t sweep_seconds = 10;
 
     Stats total_stats;
 
@@ -141,6 +146,20 @@ int main(int argc, char *const argv[])
             "--cache-size",
             cache_size,
             "Size of the node cache (in number of nodes)");
+        cli.add_option(
+            "--read-threads-sweep",
+            read_threads_sweep,
+            "Instead of the async read benchmark, measure find_owning of a "
+            "RWDb with each of these numbers of reader threads, e.g. "
+            "1,2,4,8");
+        cli.add_option(
+            "--num-find-clients",
+            num_find_clients,
+            "Number of threads calling find_owning in the reader sweep");
+        cli.add_option(
+            "--sweep-seconds",
+            sweep_seconds,
+            "Runtime of every reader count in the reader sweep");
         cli.add_option(
                "--db",
                dbname_paths,
@@ -495,8 +514,92 @@ int main(int argc, char *const argv[])
                 std::chrono::steady_clock::now() - start;
         };
 
-        // construct RWDb
         StateMachineAlwaysMerkle machine{};
+
+        // READER THREADS
+        // finds served by the reader threads of the RWDb while its worker
+        // thread keeps upserting, one run per number of reader threads
+        if (!read_threads_sweep.empty()) {
+            std::cout << "Running RWDb reader threads sweep..." << std::endl;
+            for (unsigned const read_threads : read_threads_sweep) {
+                Db db{
+                    machine,
+                    OnDiskDbConfig{
+                        .append = true,
+                        .compaction = true,
+                        .dbname_paths = {dbname_paths},
+                        .read_threads = read_threads}};
+                MONAD_ASSERT(db.num_read_threads() == read_threads);
+                version = db.get_latest_version();
+
+                std::atomic<bool> done{false};
+                std::mutex mutex;
+                OpStats stats;
+                uint64_t nfailed = 0;
+                std::vector<std::thread> clients;
+                for (unsigned i = 0; i < num_find_clients; ++i) {
+                    clients.emplace_back([&] {
+                        auto rnd = monad::thread_local_prng();
+                        std::uniform_int_distribution<size_t> dist(
+                            0, keys.size() - 1);
+                        OpStats thread_stats;
+                        uint64_t thread_failed = 0;
+                        while (!done.load(std::memory_order_acquire)) {
+                            auto const read_version =
+                                select_rand_version(db, rnd, prng_bias);
+                            auto const begin = std::chrono::steady_clock::now();
+                            // fails for a version compacted away meanwhile
+                            if (!db.find_owning(
+                                       NibblesView{keys[dist(rnd)]},
+                                       read_version)
+                                     .has_value()) {
+                                ++thread_failed;
+                            }
+                            thread_stats.time +=
+                                std::chrono::steady_clock::now() - begin;
+                            ++thread_stats.num;
+                        }
+                        auto lock = std::lock_guard<std::mutex>(mutex);
+                        stats.num += thread_stats.num;
+                        stats.time += thread_stats.time;
+                        nfailed += thread_failed;
+                    });
+                }
+
+                auto const begin = std::chrono::steady_clock::now();
+                auto const end = begin + std::chrono::seconds(sweep_seconds);
+                while (!g_done && std::chrono::steady_clock::now() < end) {
+                    ++version;
+                    upsert_new_version(db, version);
+                    std::this_thread::sleep_for(
+                        std::chrono::milliseconds(update_delay_ms));
+                }
+                done.store(true, std::memory_order_release);
+                for (auto &client : clients) {
+                    client.join();
+                }
+                auto const elapsed = std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - begin);
+
+                std::cout
+                    << "  " << read_threads << " read threads: "
+                    << static_cast<double>(stats.num) / elapsed.count()
+                    << " finds/s, latency (us): "
+                    << (stats.num != 0
+                            ? std::chrono::duration_cast<
+                                  std::chrono::microseconds>(stats.time)
+                                      .count() /
+                                  (int64_t)stats.num
+                            : 0)
+                    << ", failed: " << nfailed << std::endl;
+                if (g_done) {
+                    break;
+                }
+            }
+            return 0;
+        }
+
+        // construct RWDb
         auto const config = OnDiskDbConfig{
             .append = true, .compaction = true, .dbname_paths = {dbname_paths}};
         Db db{machine, config};
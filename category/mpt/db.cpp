@@ -47,6 +47,7 @@
 
 #include <quill/Quill.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cerrno>
 #include <chrono>
@@ -57,6 +58,9 @@
 #include <iterator>
 #include <memory>
 #include <mutex>
+#include <numeric>
+#include <optional>
+#include <span>
 #include <stdexcept>
 #include <system_error>
 #include <thread>
@@ -88,6 +92,16 @@ struct Db::Impl
     virtual find_cursor_result_type find_fiber_blocking(
         NodeCursor const &root, NibblesView const &key, uint64_t version) = 0;
     virtual size_t prefetch_fiber_blocking() = 0;
+
+    virtual void find_many_fiber_blocking(
+        NodeCursor const &root, std::span<NibblesView const> const keys,
+        std::span<find_cursor_result_type> const found, uint64_t const version)
+    {
+        for (size_t i = 0; i < keys.size(); ++i) {
+            found[i] = find_fiber_blocking(root, keys[i], version);
+        }
+    }
+
     virtual NodeCursor load_root_for_version(uint64_t version) = 0;
     virtual size_t poll(bool blocking, size_t count) = 0;
     virtual bool traverse_fiber_blocking(
@@ -99,6 +113,9 @@ struct Db::Impl
     virtual void update_verified_version(uint64_t) = 0;
     virtual uint64_t get_latest_finalized_version() const = 0;
     virtual uint64_t get_latest_verified_version() const = 0;
+    virtual unsigned num_read_threads() const = 0;
+    virtual Result<OwningNodeCursor>
+    find_owning_fiber_blocking(NibblesView const &, uint64_t version) = 0;
 };
 
 AsyncIOContext::AsyncIOContext(ReadOnlyOnDiskDbConfig const &options)
@@ -291,6 +308,17 @@ public:
     {
         return aux_.get_latest_verified_version();
     }
+
+    virtual unsigned num_read_threads() const override
+    {
+        return 0;
+    }
+
+    virtual Result<OwningNodeCursor>
+    find_owning_fiber_blocking(NibblesView const &, uint64_t) override
+    {
+        MONAD_ABORT()
+    }
 };
 
 class Db::InMemory final : public Db::Impl
@@ -375,6 +403,17 @@ public:
     {
         return INVALID_BLOCK_NUM;
     }
+
+    virtual unsigned num_read_threads() const override
+    {
+        return 0;
+    }
+
+    virtual Result<OwningNodeCursor>
+    find_owning_fiber_blocking(NibblesView const &, uint64_t) override
+    {
+        MONAD_ABORT()
+    }
 };
 
 struct OnDiskWithWorkerThreadImpl
@@ -587,6 +626,16 @@ struct OnDiskWithWorkerThreadImpl
             while (!done.load(std::memory_order_acquire)) {
                 bool did_nothing = true;
                 if (parent->comms_.try_dequeue(request)) {
+                    // CACHED FIND
+                    // requests other than finds and root loads may set, move
+                    // or free nodes that other threads are walking
+                    std::optional<decltype(aux.exclude_walks())> g;
+                    if (!std::holds_alternative<fiber_find_request_t>(
+                            request) &&
+                        !std::holds_alternative<FiberLoadRootVersionRequest>(
+                            request)) {
+                        g.emplace(aux.exclude_walks());
+                    }
                     if (auto *req = std::get_if<1>(&request); req != nullptr) {
                         // The promise needs to hang around until its future is
                         // destructed, otherwise there is a race within
@@ -806,6 +855,12 @@ class Db::RWOnDisk final
     uint64_t root_version_{INVALID_BLOCK_NUM};
     uint64_t unflushed_version_{INVALID_BLOCK_NUM};
 
+    // READER THREADS
+    // read only dbs over the same storage, each with its own thread, ring,
+    // buffers and node cache
+    std::vector<std::unique_ptr<RODb>> readers_;
+    std::atomic<size_t> next_reader_{0};
+
 public:
     RWOnDisk(OnDiskDbConfig const &options, StateMachine &machine)
         : OnDiskWithWorkerThreadImpl(options)
@@ -823,6 +878,13 @@ public:
         , root_version_(aux_->db_history_max_version())
         , unflushed_version_{INVALID_BLOCK_NUM}
     {
+        aux_->set_hashing_threads(options.hashing_threads);
+        for (unsigned i = 0; i < options.read_threads; ++i) {
+            readers_.push_back(std::make_unique<RODb>(ReadOnlyOnDiskDbConfig{
+                .capture_io_latencies = options.capture_io_latencies,
+                .eager_completions = options.eager_completions,
+                .dbname_paths = options.dbname_paths}));
+        }
     }
 
     virtual Node::UniquePtr &root() override
@@ -846,9 +908,21 @@ public:
     virtual find_cursor_result_type find_fiber_blocking(
         NodeCursor const &start, NibblesView const &key, uint64_t = 0) override
     {
-        threadsafe_boost_fibers_promise<find_cursor_result_type> promise;
+        // CACHED FIND
+        // walk the nodes in memory on this thread, and hand the find to the
+        // worker thread only from the first node to read from disk
         fiber_find_request_t req{
-            .promise = &promise, .start = start, .key = key};
+            .promise = nullptr, .start = start, .key = key};
+        if (aux_->try_begin_walk()) {
+            auto res = find_in_memory(start, req.key);
+            aux_->end_walk();
+            if (res.second != find_result::need_to_continue_in_io_thread) {
+                return res;
+            }
+            req.start = res.first;
+        }
+        threadsafe_boost_fibers_promise<find_cursor_result_type> promise;
+        req.promise = &promise;
         auto fut = promise.get_future();
         comms_.enqueue(req);
         // promise is racily emptied after this point
@@ -859,6 +933,70 @@ public:
         return fut.get();
     }
 
+    // threadsafe
+    virtual void find_many_fiber_blocking(
+        NodeCursor const &start, std::span<NibblesView const> const keys,
+        std::span<find_cursor_result_type> const found, uint64_t) override
+    {
+        // FIND MANY
+        // keys along cached paths are found on this thread, and the finds of
+        // the others are handed to the worker thread at once. The worker
+        // thread reads the nodes they share once, and the others together.
+        struct pending_t
+        {
+            size_t i;
+            NodeCursor start;
+            NibblesView key;
+        };
+
+        std::vector<pending_t> pending;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            NibblesView key = keys[i];
+            if (aux_->try_begin_walk()) {
+                auto res = find_in_memory(start, key);
+                aux_->end_walk();
+                if (res.second != find_result::need_to_continue_in_io_thread) {
+                    found[i] = res;
+                    continue;
+                }
+                pending.push_back({i, res.first, key});
+            }
+            else {
+                pending.push_back({i, start, key});
+            }
+        }
+        if (pending.empty()) {
+            return;
+        }
+        // neighbouring keys continue from the same nodes
+        std::ranges::sort(pending, [&](auto const &a, auto const &b) {
+            return keys[a.i] < keys[b.i];
+        });
+
+        std::vector<threadsafe_boost_fibers_promise<find_cursor_result_type>>
+            promises(pending.size());
+        std::vector<decltype(promises.front().get_future())> futures;
+        std::vector<Comms> reqs;
+        futures.reserve(pending.size());
+        reqs.reserve(pending.size());
+        for (size_t j = 0; j < pending.size(); ++j) {
+            futures.push_back(promises[j].get_future());
+            reqs.emplace_back(fiber_find_request_t{
+                .promise = &promises[j],
+                .start = pending[j].start,
+                .key = pending[j].key});
+        }
+        comms_.enqueue_bulk(reqs.begin(), reqs.size());
+        // promises are racily emptied after this point
+        if (worker_->sleeping.load(std::memory_order_acquire)) {
+            std::unique_lock const g(lock_);
+            cond_.notify_one();
+        }
+        for (size_t j = 0; j < pending.size(); ++j) {
+            found[pending[j].i] = futures[j].get();
+        }
+    }
+
     // threadsafe
     virtual void upsert_fiber_blocking(
         UpdateList &&updates, uint64_t const version,
@@ -1053,6 +1191,21 @@ public:
     {
         return aux().get_latest_verified_version();
     }
+
+    virtual unsigned num_read_threads() const override
+    {
+        return static_cast<unsigned>(readers_.size());
+    }
+
+    // threadsafe
+    virtual Result<OwningNodeCursor> find_owning_fiber_blocking(
+        NibblesView const &key, uint64_t const version) override
+    {
+        MONAD_ASSERT(!readers_.empty());
+        size_t const i = next_reader_.fetch_add(1, std::memory_order_relaxed) %
+                         readers_.size();
+        return readers_[i]->find(key, version);
+    }
 };
 
 struct RODb::Impl final : public OnDiskWithWorkerThreadImpl
@@ -1200,6 +1353,19 @@ Db::find(NodeCursor root, NibblesView const key, uint64_t const block_id) const
     return it;
 }
 
+unsigned Db::num_read_threads() const
+{
+    MONAD_ASSERT(impl_);
+    return impl_->num_read_threads();
+}
+
+Result<OwningNodeCursor>
+Db::find_owning(NibblesView const key, uint64_t const block_id) const
+{
+    MONAD_ASSERT(impl_);
+    return impl_->find_owning_fiber_blocking(key, block_id);
+}
+
 NodeCursor Db::load_root_for_version(uint64_t const block_id) const
 {
     MONAD_ASSERT(impl_);
@@ -1214,6 +1380,27 @@ Db::find(NibblesView const key, uint64_t const block_id) const
     return find(cursor, key, block_id);
 }
 
+std::vector<Result<NodeCursor>> Db::find_many(
+    std::span<NibblesView const> const keys, uint64_t const block_id) const
+{
+    MONAD_ASSERT(impl_);
+    auto const root = impl_->load_root_for_version(block_id);
+    std::vector<find_cursor_result_type> found(keys.size());
+    impl_->find_many_fiber_blocking(root, keys, found, block_id);
+    std::vector<Result<NodeCursor>> ret;
+    ret.reserve(found.size());
+    for (auto const &[it, result] : found) {
+        if (result != find_result::success) {
+            ret.emplace_back(find_result_to_db_error(result));
+            continue;
+        }
+        MONAD_DEBUG_ASSERT(it.node != nullptr);
+        MONAD_DEBUG_ASSERT(it.node->has_value());
+        ret.emplace_back(it);
+    }
+    return ret;
+}
+
 Result<byte_string_view>
 Db::get(NibblesView const key, uint64_t const block_id) const
 {
@@ -1417,20 +1604,20 @@ namespace detail
 
     // Reads root nodes from on disk, and supports other inflight async requests
     // from the same sender.
-    template <typename T>
+    template <class Sender>
     struct load_root_receiver_t
     {
         static constexpr bool lifetime_managed_internally = true;
 
         chunk_offset_t offset;
-        DbGetSender<T> *sender;
+        Sender *sender;
         async::erased_connected_operation *const io_state;
         chunk_offset_t rd_offset{0, 0};
         unsigned bytes_to_read;
         uint16_t buffer_off;
 
         constexpr load_root_receiver_t(
-            chunk_offset_t offset_, DbGetSender<T> *sender_,
+            chunk_offset_t offset_, Sender *sender_,
             async::erased_connected_operation *io_state_)
             : offset(offset_)
             , sender(sender_)
@@ -1483,6 +1670,54 @@ namespace detail
         }
     };
 
+    // Loads the root of `sender->block_id` into `sender->root` and
+    // `sender->res_root`, from the node cache or by joining or issuing its
+    // read, then completes `io_state`.
+    template <class Sender>
+    void async_load_root(
+        Sender *const sender, async::erased_connected_operation *const io_state)
+    {
+        AsyncContext &context = sender->context;
+        uint64_t const block_id = sender->block_id;
+        chunk_offset_t const offset =
+            context.aux.get_root_offset_at_version(block_id);
+        auto virt_offset = context.aux.physical_to_virtual(offset);
+        NodeCache::ConstAccessor acc;
+        if (context.node_cache.find(acc, virt_offset)) {
+            // found in LRU - no IO necessary
+            sender->root = acc->second->val.first;
+            sender->res_root = {{sender->root}, find_result::success};
+            io_state->completed(async::success());
+            return;
+        }
+        if (offset == INVALID_OFFSET) {
+            // root is no longer valid
+            sender->res_root = {{}, find_result::version_no_longer_exist};
+            io_state->completed(async::success());
+            return;
+        }
+
+        auto cont = [sender, io_state](std::shared_ptr<CacheNode> root_) {
+            if (!root_) {
+                sender->res_root = {{}, find_result::version_no_longer_exist};
+            }
+            else {
+                sender->root = root_;
+                sender->res_root = {{sender->root}, find_result::success};
+            }
+            io_state->completed(async::success());
+        };
+        auto &inflights = context.inflight_roots;
+        if (auto it = inflights.find(block_id); it != inflights.end()) {
+            it->second.emplace_back(cont);
+        }
+        else {
+            inflights[block_id].emplace_back(cont);
+            async_read(
+                context.aux, load_root_receiver_t{offset, sender, io_state});
+        }
+    }
+
     // Processes results from find_request_sender, proxying the result back to
     // the DbGetSender.
     template <return_type T>
@@ -1525,46 +1760,9 @@ namespace detail
         switch (op_type) {
         case op_t::op_get1:
         case op_t::op_get_data1:
-        case op_t::op_get_node1: {
-            chunk_offset_t const offset =
-                context.aux.get_root_offset_at_version(block_id);
-            auto virt_offset = context.aux.physical_to_virtual(offset);
-            NodeCache::ConstAccessor acc;
-            if (context.node_cache.find(acc, virt_offset)) {
-                // found in LRU - no IO necessary
-                root = acc->second->val.first;
-                res_root = {{root}, find_result::success};
-                io_state->completed(async::success());
-                return async::success();
-            }
-            if (offset == INVALID_OFFSET) {
-                // root is no longer valid
-                res_root = {{}, find_result::version_no_longer_exist};
-                io_state->completed(async::success());
-                return async::success();
-            }
-
-            auto cont = [this, io_state](std::shared_ptr<CacheNode> root_) {
-                if (!root_) {
-                    res_root = {{}, find_result::version_no_longer_exist};
-                }
-                else {
-                    root = root_;
-                    res_root = {{root}, find_result::success};
-                }
-                io_state->completed(async::success());
-            };
-            auto &inflights = context.inflight_roots;
-            if (auto it = inflights.find(block_id); it != inflights.end()) {
-                it->second.emplace_back(cont);
-            }
-            else {
-                inflights[block_id].emplace_back(cont);
-                async_read(
-                    context.aux, load_root_receiver_t{offset, this, io_state});
-            }
+        case op_t::op_get_node1:
+            async_load_root(this, io_state);
             return async::success();
-        }
         case op_t::op_get2:
         case op_t::op_get_data2:
         case op_t::op_get_node2: {
@@ -1635,8 +1833,126 @@ namespace detail
         abort();
     }
 
+    // Processes results from find_request_sender for one key of a
+    // DbGetManySender, completing it after the last key.
+    template <return_type T>
+    struct find_many_receiver_t
+    {
+        DbGetManySender<T> *const sender;
+        size_t const i;
+        async::erased_connected_operation *const io_state;
+
+        enum : bool
+        {
+            lifetime_managed_internally = true
+        };
+
+        void set_value(
+            async::erased_connected_operation *const this_io_state,
+            find_request_sender<T>::result_type res)
+        {
+            if (!res) {
+                sender->status = std::move(res).as_failure();
+            }
+            else {
+                sender->get_results[i] =
+                    sender->context.aux.version_is_valid_ondisk(
+                        sender->block_id)
+                        ? std::move(res).assume_value()
+                        : find_result_type<T>{
+                              T{}, find_result::version_no_longer_exist};
+            }
+            auto *const parent = sender;
+            auto *const parent_io_state = io_state;
+            delete this_io_state;
+            // the sender may be destroyed on completion
+            if (--parent->pending == 0) {
+                parent_io_state->completed(std::move(parent->status));
+            }
+        }
+    };
+
+    template <return_type T>
+    async::result<void> DbGetManySender<T>::operator()(
+        async::erased_connected_operation *io_state) noexcept
+    {
+        switch (op_type) {
+        case op_t::op_load_root:
+            async_load_root(this, io_state);
+            return async::success();
+        case op_t::op_find: {
+            get_results.assign(keys.size(), {T{}, find_result::unknown});
+            // verify version is valid in db history before doing anything
+            if (!context.aux.version_is_valid_ondisk(block_id)) {
+                for (auto &res : get_results) {
+                    res.second = find_result::version_no_longer_exist;
+                }
+                io_state->completed(async::success());
+                return async::success();
+            }
+
+            std::vector<size_t> order(keys.size());
+            std::iota(order.begin(), order.end(), size_t{0});
+            std::ranges::sort(order, [this](size_t const a, size_t const b) {
+                return keys[a] < keys[b];
+            });
+            // held until every find is initiated, as finds of cached nodes
+            // complete immediately
+            pending = keys.size() + 1;
+            for (size_t const i : order) {
+                auto *state = new auto(async::connect(
+                    find_request_sender<T>(
+                        context.aux,
+                        context.node_cache,
+                        context.inflight_nodes,
+                        OwningNodeCursor{root},
+                        block_id,
+                        keys[i],
+                        return_value),
+                    find_many_receiver_t<T>{this, i, io_state}));
+                state->initiate();
+            }
+            if (--pending == 0) {
+                io_state->completed(std::move(status));
+            }
+            return async::success();
+        }
+        }
+        MONAD_ABORT();
+    }
+
+    template <return_type T>
+    DbGetManySender<T>::result_type DbGetManySender<T>::completed(
+        async::erased_connected_operation *, async::result<void> r) noexcept
+    {
+        BOOST_OUTCOME_TRY(std::move(r));
+        if (op_type == op_t::op_load_root) {
+            MONAD_ASSERT(res_root.second != find_result::unknown);
+            if (res_root.second != find_result::success) {
+                return find_result_to_db_error(res_root.second);
+            }
+            // Restart this op
+            op_type = op_t::op_find;
+            return async::sender_errc::operation_must_be_reinitiated;
+        }
+        std::vector<async::result<T>> ret;
+        ret.reserve(get_results.size());
+        for (auto &[value, result] : get_results) {
+            MONAD_ASSERT(result != find_result::unknown);
+            if (result != find_result::success) {
+                ret.emplace_back(find_result_to_db_error(result));
+            }
+            else {
+                ret.emplace_back(std::move(value));
+            }
+        }
+        return {std::move(ret)};
+    }
+
     template struct DbGetSender<byte_string>;
     template struct DbGetSender<std::shared_ptr<CacheNode>>;
+    template struct DbGetManySender<byte_string>;
+    template struct DbGetManySender<std::shared_ptr<CacheNode>>;
 }
 
 MONAD_MPT_NAMESPACE_END
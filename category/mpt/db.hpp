@@ -16,6 +16,8 @@
 #pragma once
 
 #include <memory>
+#include <span>
+#include <vector>
 
 #include <category/async/concepts.hpp>
 #include <category/async/config.hpp>
@@ -118,6 +120,22 @@ public:
     Result<byte_string_view>
     get_data(NodeCursor, NibblesView, uint64_t block_id) const;
 
+    // FIND MANY
+    // Finds every key from the root of `block_id`, with results in the
+    // order of `keys`. Finds of keys sharing a prefix share the reads of its
+    // nodes, and on disk the reads for all keys are in flight at once.
+    std::vector<Result<NodeCursor>>
+    find_many(std::span<NibblesView const> keys, uint64_t block_id) const;
+
+    // READER THREADS
+    // An on disk RWDb configured with `read_threads` also serves finds on
+    // that many reader threads, concurrently with upserts on its worker
+    // thread. Readers find from the root written for `block_id`, so they do
+    // not see an upsert until it writes its root. Unlike `find`, the result
+    // owns its node and stays valid across upserts. RW only.
+    unsigned num_read_threads() const;
+    Result<OwningNodeCursor> find_owning(NibblesView, uint64_t block_id) const;
+
     NodeCursor load_root_for_version(uint64_t block_id) const;
 
     void copy_trie(
@@ -248,6 +266,51 @@ namespace detail
             async::erased_connected_operation *,
             async::result<void> res) noexcept;
     };
+
+    // FIND MANY
+    // Loads the root, then initiates the finds of all keys at once, sorted
+    // so that neighbouring finds share the nodes in cache and the reads in
+    // flight. Results are in the order of the keys.
+    template <return_type T>
+    struct DbGetManySender
+    {
+        using result_type = async::result<std::vector<async::result<T>>>;
+
+        AsyncContext &context;
+
+        enum op_t : uint8_t
+        {
+            op_load_root,
+            op_find
+        } op_type{op_load_root};
+
+        bool const return_value;
+        std::shared_ptr<CacheNode> root;
+        std::vector<Nibbles> const keys;
+        uint64_t const block_id;
+
+        find_result_type<OwningNodeCursor> res_root;
+        std::vector<find_result_type<T>> get_results;
+        async::result<void> status{async::success()};
+        size_t pending{0};
+
+        DbGetManySender(
+            AsyncContext &context_, std::span<NibblesView const> const keys_,
+            uint64_t const block_id_, bool const return_value_)
+            : context(context_)
+            , return_value(return_value_)
+            , keys(keys_.begin(), keys_.end())
+            , block_id(block_id_)
+        {
+        }
+
+        async::result<void>
+        operator()(async::erased_connected_operation *io_state) noexcept;
+
+        result_type completed(
+            async::erased_connected_operation *,
+            async::result<void> res) noexcept;
+    };
 }
 
 inline detail::TraverseSender make_traverse_sender(
@@ -297,4 +360,21 @@ inline detail::DbGetSender<std::shared_ptr<CacheNode>> make_get_node_sender(
         block_id};
 }
 
+inline detail::DbGetManySender<byte_string> make_get_many_sender(
+    AsyncContext *const context, std::span<NibblesView const> const keys,
+    uint64_t const block_id)
+{
+    MONAD_ASSERT(context);
+    return {*context, keys, block_id, true};
+}
+
+inline detail::DbGetManySender<std::shared_ptr<CacheNode>>
+make_get_node_many_sender(
+    AsyncContext *const context, std::span<NibblesView const> const keys,
+    uint64_t const block_id)
+{
+    MONAD_ASSERT(context);
+    return {*context, keys, block_id, false};
+}
+
 MONAD_MPT_NAMESPACE_END
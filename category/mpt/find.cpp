@@ -85,4 +85,49 @@ find_cursor_result_type find_blocking(
     return {NodeCursor{*node, node_prefix_index}, find_result::success};
 }
 
+find_cursor_result_type
+find_in_memory(NodeCursor const root, NibblesView &key)
+{
+    if (!root.is_valid()) {
+        return {NodeCursor{}, find_result::root_node_is_null_failure};
+    }
+    Node *node = root.node;
+    unsigned node_prefix_index = root.prefix_index;
+    unsigned prefix_index = 0;
+    while (prefix_index < key.nibble_size()) {
+        unsigned char const nibble = key.get(prefix_index);
+        if (node->path_nibbles_len() == node_prefix_index) {
+            if (!(node->mask & (1u << nibble))) {
+                return {
+                    NodeCursor{*node, node_prefix_index},
+                    find_result::branch_not_exist_failure};
+            }
+            Node *const next = node->next(node->to_child_index(nibble));
+            if (next == nullptr) {
+                key = key.substr(prefix_index);
+                return {
+                    NodeCursor{*node, node_prefix_index},
+                    find_result::need_to_continue_in_io_thread};
+            }
+            node = next;
+            node_prefix_index = 0;
+            ++prefix_index;
+            continue;
+        }
+        if (nibble != node->path_nibble_view().get(node_prefix_index)) {
+            return {
+                NodeCursor{*node, node_prefix_index},
+                find_result::key_mismatch_failure};
+        }
+        ++prefix_index;
+        ++node_prefix_index;
+    }
+    if (node_prefix_index != node->path_nibbles_len()) {
+        return {
+            NodeCursor{*node, node_prefix_index},
+            find_result::key_ends_earlier_than_node_failure};
+    }
+    return {NodeCursor{*node, node_prefix_index}, find_result::success};
+}
+
 MONAD_MPT_NAMESPACE_END
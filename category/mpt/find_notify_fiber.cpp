@@ -93,6 +93,7 @@ namespace
             auto const offset = parent->fnext(branch_index);
             auto *node = parent->next(branch_index);
             if (node == nullptr) {
+                auto const g(aux->exclude_walks());
                 parent->set_next(
                     branch_index,
                     detail::deserialize_node_from_receiver_result<Node>(
@@ -44,6 +44,12 @@ struct OnDiskDbConfig
     // fixed history length if contains value, otherwise rely on db to adjust
     // history length upon disk usage
     std::optional<uint64_t> fixed_history_length{std::nullopt};
+    // threads building and hashing large fresh subtries of an upsert, 0
+    // keeps all of an upsert on the worker thread
+    unsigned hashing_threads{0};
+    // threads serving find_owning with their own io_uring, 0 disables
+    // find_owning
+    unsigned read_threads{0};
 };
 
 struct ReadOnlyOnDiskDbConfig
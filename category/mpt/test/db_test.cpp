@@ -147,7 +147,7 @@ namespace
 
     struct OnDiskDbWithFileAsyncFixture : public OnDiskDbWithFileFixture
     {
-        template <return_type T>
+        template <class T>
         using result_t = monad::Result<T>;
 
         AsyncIOContext io_ctx;
@@ -163,7 +163,7 @@ namespace
         {
         }
 
-        template <return_type T>
+        template <class T>
         void async_get(auto &&sender, std::function<void(result_t<T>)> callback)
         {
             using sender_type = std::decay_t<decltype(sender)>;
@@ -613,6 +613,60 @@ TEST_F(OnDiskDbWithFileAsyncFixture, read_only_db_single_thread_async)
     poll_until(1);
 }
 
+TEST_F(OnDiskDbWithFileAsyncFixture, get_many_async)
+{
+    auto const &kv = fixed_updates::kv;
+    auto const prefix = 0x00_hex;
+    upsert_updates_flat_list(
+        db,
+        prefix,
+        0,
+        make_update(kv[0].first, kv[0].second),
+        make_update(kv[1].first, kv[1].second),
+        make_update(kv[2].first, kv[2].second));
+
+    // out of order, with a missing key and a repeated key
+    std::vector<monad::byte_string> const keys{
+        prefix + kv[2].first,
+        prefix + kv[0].first,
+        prefix + 0x12345678_hex,
+        prefix + kv[1].first,
+        prefix + kv[0].first};
+    std::vector<NibblesView> const views(keys.begin(), keys.end());
+    using values_t = std::vector<monad::async::result<monad::byte_string>>;
+    async_get<values_t>(
+        make_get_many_sender(ctx.get(), views, 0),
+        [&](result_t<values_t> res) {
+            ASSERT_TRUE(res.has_value());
+            auto const &values = res.value();
+            ASSERT_EQ(values.size(), keys.size());
+            EXPECT_EQ(values[0].value(), kv[2].second);
+            EXPECT_EQ(values[1].value(), kv[0].second);
+            ASSERT_TRUE(values[2].has_error());
+            EXPECT_EQ(values[2].error(), DbError::key_not_found);
+            EXPECT_EQ(values[3].value(), kv[1].second);
+            EXPECT_EQ(values[4].value(), kv[0].second);
+        });
+    using nodes_t =
+        std::vector<monad::async::result<std::shared_ptr<CacheNode>>>;
+    async_get<nodes_t>(
+        make_get_node_many_sender(ctx.get(), views, 0),
+        [&](result_t<nodes_t> res) {
+            ASSERT_TRUE(res.has_value());
+            auto const &nodes = res.value();
+            ASSERT_EQ(nodes.size(), keys.size());
+            EXPECT_EQ(nodes[0].value()->value(), kv[2].second);
+            EXPECT_TRUE(nodes[2].has_error());
+        });
+    async_get<values_t>(
+        make_get_many_sender(ctx.get(), views, 1),
+        [&](result_t<values_t> res) {
+            ASSERT_TRUE(res.has_error());
+            EXPECT_EQ(res.error(), DbError::version_no_longer_exist);
+        });
+    poll_until(3);
+}
+
 TEST_F(OnDiskDbWithFileFixture, open_emtpy_rodb)
 {
     // construct RODb
@@ -744,6 +798,285 @@ TEST_F(OnDiskDbWithFileFixture, upsert_but_not_write_root)
     EXPECT_EQ(res2.value(), k2);
 }
 
+TEST(DbTest, read_threads)
+{
+    auto const dbname = create_temp_file(8);
+    auto undb = monad::make_scope_exit(
+        [&]() noexcept { std::filesystem::remove(dbname); });
+    StateMachineAlwaysMerkle machine;
+    Db db{
+        machine,
+        OnDiskDbConfig{
+            .sq_thread_cpu = std::nullopt,
+            .dbname_paths = {dbname},
+            .fixed_history_length = DBTEST_HISTORY_LENGTH,
+            .read_threads = 2}};
+    EXPECT_EQ(db.num_read_threads(), 2u);
+
+    auto const prefix = 0x00_hex;
+    auto const k1 = 0x12345678_hex;
+    auto const k2 = 0x22345678_hex;
+    auto const v1 = 0xdeadbeef_hex;
+    auto const v2 = 0xcafebabe_hex;
+    upsert_updates_flat_list(
+        db, prefix, 0, make_update(k1, v1), make_update(k2, v1));
+
+    auto const find = [&](auto const &key, uint64_t const version) {
+        return db.find_owning(NibblesView{prefix + key}, version);
+    };
+    for (unsigned i = 0; i < 4; ++i) { // every reader
+        auto const res = find(k1, 0);
+        ASSERT_TRUE(res.has_value());
+        EXPECT_EQ(res.value().node->value(), v1);
+    }
+    auto const missing = find(0x32345678_hex, 0);
+    ASSERT_TRUE(missing.has_error());
+    EXPECT_TRUE(missing.assume_error() == DbError::key_not_found);
+
+    // readers do not see an upsert before it writes its root
+    UpdateList ul;
+    auto u = make_update(k1, v2);
+    ul.push_front(u);
+    auto u_prefix = Update{
+        .key = prefix,
+        .value = monad::byte_string_view{},
+        .incarnation = false,
+        .next = std::move(ul),
+        .version = 1};
+    UpdateList ul_prefix;
+    ul_prefix.push_front(u_prefix);
+    db.upsert(std::move(ul_prefix), 1, true, true, false);
+    EXPECT_TRUE(find(k1, 1).has_error());
+    upsert_updates_flat_list(db, prefix, 1, make_update(k2, v2));
+
+    auto const res0 = find(k1, 0);
+    ASSERT_TRUE(res0.has_value());
+    EXPECT_EQ(res0.value().node->value(), v1);
+    auto const res1 = find(k1, 1);
+    ASSERT_TRUE(res1.has_value());
+    EXPECT_EQ(res1.value().node->value(), v2);
+
+    // reads on other threads while the worker thread upserts
+    std::atomic<bool> done{false};
+    std::vector<std::thread> readers;
+    for (unsigned i = 0; i < 4; ++i) {
+        readers.emplace_back([&] {
+            while (!done.load(std::memory_order_acquire)) {
+                auto const res = find(k2, 1);
+                ASSERT_TRUE(res.has_value());
+                EXPECT_EQ(res.value().node->value(), v2);
+            }
+        });
+    }
+    for (uint64_t version = 2; version < 100; ++version) {
+        upsert_updates_flat_list(
+            db,
+            prefix,
+            version,
+            make_update(serialize_as_big_endian<6>(version), v1));
+    }
+    done.store(true, std::memory_order_release);
+    for (auto &reader : readers) {
+        reader.join();
+    }
+}
+
+TEST(DbTest, DISABLED_read_threads_scaling)
+{
+    constexpr uint64_t N = 1'000'000;
+    constexpr unsigned CLIENTS = 64;
+    auto const prefix = 0x00_hex;
+
+    for (unsigned const read_threads : {1, 2, 4, 8}) {
+        auto const dbname = create_temp_file(8);
+        auto undb = monad::make_scope_exit(
+            [&]() noexcept { std::filesystem::remove(dbname); });
+        StateMachineAlwaysMerkle machine;
+        Db db{
+            machine,
+            OnDiskDbConfig{
+                .sq_thread_cpu = std::nullopt,
+                .dbname_paths = {dbname},
+                .fixed_history_length = DBTEST_HISTORY_LENGTH,
+                .read_threads = read_threads}};
+        std::vector<monad::byte_string> keys;
+        std::deque<Update> alloc;
+        UpdateList ul;
+        for (uint64_t i = 0; i < N; ++i) {
+            monad::byte_string &key = keys.emplace_back(32, 0);
+            keccak256((unsigned char const *)&i, 8, key.data());
+        }
+        for (auto const &key : keys) {
+            ul.push_front(alloc.emplace_back(make_update(key, key)));
+        }
+        auto u_prefix = Update{
+            .key = prefix,
+            .value = monad::byte_string_view{},
+            .incarnation = false,
+            .next = std::move(ul),
+            .version = 0};
+        UpdateList ul_prefix;
+        ul_prefix.push_front(u_prefix);
+        db.upsert(std::move(ul_prefix), 0);
+
+        std::atomic<bool> done{false};
+        std::atomic<uint64_t> nreads{0};
+        std::vector<std::thread> clients;
+        for (unsigned i = 0; i < CLIENTS; ++i) {
+            clients.emplace_back([&, i] {
+                monad::small_prng rand{i};
+                uint64_t n = 0;
+                while (!done.load(std::memory_order_acquire)) {
+                    auto const &key = keys[rand() % N];
+                    auto const res =
+                        db.find_owning(NibblesView{prefix + key}, 0);
+                    MONAD_ASSERT(res.has_value());
+                    ++n;
+                }
+                nreads.fetch_add(n, std::memory_order_relaxed);
+            });
+        }
+        auto const begin = std::chrono::steady_clock::now();
+        std::this_thread::sleep_for(std::chrono::seconds(5));
+        done.store(true, std::memory_order_release);
+        for (auto &client : clients) {
+            client.join();
+        }
+        auto const elapsed = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - begin);
+        std::cout << "   " << read_threads << " read threads: "
+                  << static_cast<double>(nreads.load()) / elapsed.count()
+                  << " reads/s" << std::endl;
+    }
+}
+
+TEST(DbTest, find_in_memory)
+{
+    auto const dbname = create_temp_file(8);
+    auto undb = monad::make_scope_exit(
+        [&]() noexcept { std::filesystem::remove(dbname); });
+    StateMachineAlwaysMerkle machine;
+    OnDiskDbConfig config{
+        .sq_thread_cpu = std::nullopt,
+        .dbname_paths = {dbname},
+        .fixed_history_length = DBTEST_HISTORY_LENGTH};
+
+    auto const prefix = 0x00_hex;
+    std::vector<monad::byte_string> keys;
+    for (uint64_t i = 0; i < 64; ++i) {
+        monad::byte_string &key = keys.emplace_back(32, 0);
+        keccak256((unsigned char const *)&i, 8, key.data());
+    }
+    {
+        Db db{machine, config};
+        std::deque<Update> alloc;
+        UpdateList ul;
+        for (auto const &key : keys) {
+            ul.push_front(alloc.emplace_back(make_update(key, key)));
+        }
+        auto u_prefix = Update{
+            .key = prefix,
+            .value = monad::byte_string_view{},
+            .incarnation = false,
+            .next = std::move(ul),
+            .version = 0};
+        UpdateList ul_prefix;
+        ul_prefix.push_front(u_prefix);
+        db.upsert(std::move(ul_prefix), 0);
+    }
+
+    // reopened, only the root is in memory, the first finds continue on the
+    // worker thread and the later ones stay on the calling threads
+    config.append = true;
+    Db db{machine, config};
+    std::vector<std::thread> clients;
+    for (unsigned i = 0; i < 4; ++i) {
+        clients.emplace_back([&] {
+            for (unsigned n = 0; n < 3; ++n) {
+                for (auto const &key : keys) {
+                    auto const res = db.find(NibblesView{prefix + key}, 0);
+                    ASSERT_TRUE(res.has_value());
+                    EXPECT_EQ(res.value().node->value(), key);
+                }
+                auto const missing =
+                    db.find(NibblesView{prefix + 0x12345678_hex}, 0);
+                ASSERT_TRUE(missing.has_error());
+            }
+        });
+    }
+    for (auto &client : clients) {
+        client.join();
+    }
+
+    // an upsert frees the nodes found before, then finds see the new values
+    std::deque<Update> alloc;
+    UpdateList ul;
+    for (auto const &key : keys) {
+        ul.push_front(alloc.emplace_back(make_update(key, prefix + key)));
+    }
+    auto u_prefix = Update{
+        .key = prefix,
+        .value = monad::byte_string_view{},
+        .incarnation = false,
+        .next = std::move(ul),
+        .version = 1};
+    UpdateList ul_prefix;
+    ul_prefix.push_front(u_prefix);
+    db.upsert(std::move(ul_prefix), 1);
+    for (auto const &key : keys) {
+        auto const res = db.find(NibblesView{prefix + key}, 1);
+        ASSERT_TRUE(res.has_value());
+        EXPECT_EQ(res.value().node->value(), prefix + key);
+    }
+}
+
+TEST(DbTest, DISABLED_find_in_memory_latency)
+{
+    constexpr uint64_t N = 100'000;
+    auto const dbname = create_temp_file(8);
+    auto undb = monad::make_scope_exit(
+        [&]() noexcept { std::filesystem::remove(dbname); });
+    StateMachineAlwaysMerkle machine;
+    Db db{
+        machine,
+        OnDiskDbConfig{
+            .sq_thread_cpu = std::nullopt,
+            .dbname_paths = {dbname},
+            .fixed_history_length = DBTEST_HISTORY_LENGTH}};
+    auto const prefix = 0x00_hex;
+    std::vector<monad::byte_string> keys;
+    std::deque<Update> alloc;
+    UpdateList ul;
+    for (uint64_t i = 0; i < N; ++i) {
+        monad::byte_string &key = keys.emplace_back(32, 0);
+        keccak256((unsigned char const *)&i, 8, key.data());
+    }
+    for (auto const &key : keys) {
+        ul.push_front(alloc.emplace_back(make_update(key, key)));
+    }
+    auto u_prefix = Update{
+        .key = prefix,
+        .value = monad::byte_string_view{},
+        .incarnation = false,
+        .next = std::move(ul),
+        .version = 0};
+    UpdateList ul_prefix;
+    ul_prefix.push_front(u_prefix);
+    db.upsert(std::move(ul_prefix), 0);
+
+    for (unsigned pass = 0; pass < 2; ++pass) {
+        auto const begin = std::chrono::steady_clock::now();
+        for (auto const &key : keys) {
+            MONAD_ASSERT(db.find(NibblesView{prefix + key}, 0).has_value());
+        }
+        auto const elapsed = std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - begin);
+        std::cout << "   pass " << pass << ": "
+                  << elapsed.count() / static_cast<double>(N) << " ns/find"
+                  << std::endl;
+    }
+}
+
 TEST(DbTest, history_length_adjustment_never_under_min)
 {
     auto const dbname = create_temp_file(4);
@@ -1344,6 +1677,40 @@ TYPED_TEST(DbTest, simple_with_same_prefix)
     EXPECT_FALSE(this->db.get(0x01_hex, block_id).has_value());
 }
 
+TYPED_TEST(DbTest, find_many)
+{
+    auto const &kv = fixed_updates::kv;
+    auto const prefix = 0x00_hex;
+    upsert_updates_flat_list(
+        this->db,
+        prefix,
+        0,
+        make_update(kv[0].first, kv[0].second),
+        make_update(kv[1].first, kv[1].second),
+        make_update(kv[2].first, kv[2].second));
+
+    // out of order, with a missing key and a repeated key
+    std::vector<monad::byte_string> const keys{
+        prefix + kv[2].first,
+        prefix + kv[0].first,
+        prefix + 0x12345678_hex,
+        prefix + kv[1].first,
+        prefix + kv[0].first};
+    std::vector<NibblesView> const views(keys.begin(), keys.end());
+    auto const found = this->db.find_many(views, 0);
+    ASSERT_EQ(found.size(), keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        auto const res = this->db.find(views[i], 0);
+        ASSERT_EQ(found[i].has_value(), res.has_value()) << i;
+        if (res.has_value()) {
+            EXPECT_EQ(found[i].value().node, res.value().node) << i;
+        }
+    }
+    EXPECT_EQ(found[0].value().node->value(), kv[2].second);
+    EXPECT_TRUE(found[2].assume_error() == DbError::key_not_found);
+    EXPECT_TRUE(this->db.find_many({}, 0).empty());
+}
+
 TYPED_TEST(DbTest, simple_with_increasing_block_id_prefix)
 {
     auto const &kv = fixed_updates::kv;
@@ -33,6 +33,7 @@
 #include <iterator>
 #include <memory>
 #include <optional>
+#include <random>
 #include <utility>
 #include <vector>
 
@@ -769,3 +770,64 @@ TYPED_TEST(TrieTest, single_value_variable_length_trie_with_prefix)
         this->root->data(),
         0x82a7b59bf8abe584aef31b580efaadbf19d0eba0e4ea8986e23db14ba9be6cb2_hex);
 }
+
+TYPED_TEST(TrieTest, parallel_hashing)
+{
+    std::mt19937_64 rng{42};
+    auto const random_bytes = [&rng](size_t const n) {
+        monad::byte_string bytes(n, 0);
+        for (auto &byte : bytes) {
+            byte = static_cast<unsigned char>(rng());
+        }
+        return bytes;
+    };
+    std::vector<std::pair<monad::byte_string, monad::byte_string>> kv;
+    for (unsigned i = 0; i < 2000; ++i) {
+        kv.emplace_back(random_bytes(32), random_bytes(8));
+    }
+    // the storage of kv[0]
+    std::vector<std::pair<monad::byte_string, monad::byte_string>> storage_kv;
+    for (unsigned i = 0; i < 1000; ++i) {
+        storage_kv.emplace_back(random_bytes(32), random_bytes(8));
+    }
+
+    auto const upsert_all = [&](uint64_t const version) {
+        std::vector<Update> storage;
+        for (auto const &[key, value] : storage_kv) {
+            storage.push_back(make_update(key, value));
+        }
+        UpdateList storage_ls;
+        for (auto &update : storage) {
+            storage_ls.push_front(update);
+        }
+        std::vector<Update> updates;
+        updates.reserve(kv.size());
+        updates.push_back(make_update(
+            kv[0].first, kv[0].second, false, std::move(storage_ls)));
+        for (size_t i = 1; i < kv.size(); ++i) {
+            updates.push_back(make_update(kv[i].first, kv[i].second));
+        }
+        return upsert_vector(
+            this->aux, *this->sm, {}, std::move(updates), version);
+    };
+
+    this->root = upsert_all(0);
+    auto const expected = this->root_hash();
+
+    this->reset();
+    this->aux.set_hashing_threads(4);
+    this->root = upsert_all(1);
+    EXPECT_EQ(this->root_hash(), expected);
+    for (auto const &[key, value] : kv) {
+        auto const [it, res] = find_blocking(this->aux, *this->root, key, 1);
+        ASSERT_EQ(res, monad::mpt::find_result::success);
+        EXPECT_EQ(it.node->value(), value);
+    }
+    for (auto const &[key, value] : storage_kv) {
+        auto const [it, res] = find_blocking(
+            this->aux, *this->root, kv[0].first + key, 1);
+        ASSERT_EQ(res, monad::mpt::find_result::success);
+        EXPECT_EQ(it.node->value(), value);
+    }
+    this->aux.set_hashing_threads(0);
+}
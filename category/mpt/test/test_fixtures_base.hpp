@@ -98,9 +98,9 @@ namespace monad::test
 
         virtual Compute &get_compute() const override
         {
-            static MerkleCompute m{};
-            static RootMerkleCompute rm{};
-            static EmptyCompute e{};
+            thread_local MerkleCompute m{};
+            thread_local RootMerkleCompute rm{};
+            thread_local EmptyCompute e{};
             if (MONAD_LIKELY(depth > prefix_len)) {
                 return m;
             }
@@ -157,9 +157,9 @@ namespace monad::test
 
         virtual Compute &get_compute() const override
         {
-            static VarLenMerkleCompute m{};
-            static RootVarLenMerkleCompute rm{};
-            static EmptyCompute e{};
+            thread_local VarLenMerkleCompute m{};
+            thread_local RootVarLenMerkleCompute rm{};
+            thread_local EmptyCompute e{};
             if (MONAD_LIKELY(depth > prefix_len)) {
                 return m;
             }
@@ -223,7 +223,7 @@ namespace monad::test
 
         virtual Compute &get_compute() const override
         {
-            static Compute c{};
+            thread_local Compute c{};
             return c;
         }
 
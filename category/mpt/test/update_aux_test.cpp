@@ -15,6 +15,7 @@
 
 #include "gtest/gtest.h"
 
+#include <atomic>
 #include <chrono>
 #include <thread>
 
@@ -197,3 +198,40 @@ TEST(update_aux_test, root_offsets_fast_slow)
             "Detected corruption");
     }
 }
+
+TEST(update_aux_test, exclude_walks)
+{
+    monad::mpt::UpdateAux aux{};
+
+    // walks begin and end freely
+    ASSERT_TRUE(aux.try_begin_walk());
+    ASSERT_TRUE(aux.try_begin_walk());
+    aux.end_walk();
+    aux.end_walk();
+
+    {
+        auto const g = aux.exclude_walks();
+        EXPECT_FALSE(aux.try_begin_walk());
+        {
+            auto const nested = aux.exclude_walks();
+            EXPECT_FALSE(aux.try_begin_walk());
+        }
+        // still excluded after the nested exclusion
+        EXPECT_FALSE(aux.try_begin_walk());
+    }
+    ASSERT_TRUE(aux.try_begin_walk());
+
+    // an exclusion waits for the walk in progress
+    std::atomic<bool> excluded{false};
+    std::jthread excluder([&] {
+        auto const g = aux.exclude_walks();
+        excluded = true;
+    });
+    std::this_thread::sleep_for(50ms);
+    EXPECT_FALSE(excluded);
+    aux.end_walk();
+    excluder.join();
+    EXPECT_TRUE(excluded);
+    ASSERT_TRUE(aux.try_begin_walk());
+    aux.end_walk();
+}
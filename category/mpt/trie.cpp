@@ -31,6 +31,9 @@
 #include <category/mpt/upward_tnode.hpp>
 #include <category/mpt/util.hpp>
 
+#include <oneapi/tbb/task_arena.h>
+#include <oneapi/tbb/task_group.h>
+
 #include <quill/Quill.h>
 
 #include <algorithm>
@@ -67,14 +70,18 @@ void mismatch_handler_(
     Node::UniquePtr old, Requests &, NibblesView path,
     unsigned old_prefix_index, unsigned prefix_index);
 
+// `defer_writes` builds the subtrie in memory only, on a hashing thread,
+// see write_subtrie_built_aside_
 void create_new_trie_(
     UpdateAuxImpl &aux, StateMachine &sm, int64_t &parent_version,
-    ChildData &entry, UpdateList &&updates, unsigned prefix_index = 0);
+    ChildData &entry, UpdateList &&updates, unsigned prefix_index = 0,
+    bool defer_writes = false);
 
 void create_new_trie_from_requests_(
     UpdateAuxImpl &, StateMachine &, int64_t &parent_version, ChildData &,
     Requests &, NibblesView path, unsigned prefix_index,
-    std::optional<byte_string_view> opt_leaf_data, int64_t version);
+    std::optional<byte_string_view> opt_leaf_data, int64_t version,
+    bool defer_writes = false);
 
 void upsert_(
     UpdateAuxImpl &, StateMachine &, UpdateTNode &parent, ChildData &,
@@ -742,9 +749,11 @@ Node::UniquePtr create_node_from_children_if_any(
     UpdateAuxImpl &aux, StateMachine &sm, uint16_t const orig_mask,
     uint16_t const mask, std::span<ChildData> const children,
     NibblesView const path, std::optional<byte_string_view> const leaf_data,
-    int64_t const version)
+    int64_t const version, bool const defer_writes = false)
 {
-    aux.collect_number_nodes_created_stats();
+    if (!defer_writes) { // stats are not thread safe
+        aux.collect_number_nodes_created_stats();
+    }
     // handle non child and single child cases
     auto const number_of_children = static_cast<unsigned>(std::popcount(mask));
     if (number_of_children == 0) {
@@ -773,7 +782,7 @@ Node::UniquePtr create_node_from_children_if_any(
         number_of_children > 1 ||
         (number_of_children == 1 && leaf_data.has_value()));
     // write children to disk, free any if exceeds the cache level limit
-    if (aux.is_on_disk()) {
+    if (aux.is_on_disk() && !defer_writes) {
         for (auto &child : children) {
             if (child.is_valid() && child.offset == INVALID_OFFSET) {
                 // write updated node or node to be compacted to disk
@@ -900,9 +909,102 @@ void update_value_and_subtrie_(
 /////////////////////////////////////////////////////
 // Create a new trie from a list of updates, no incarnation
 /////////////////////////////////////////////////////
+
+// PARALLEL HASH
+// Below this many updates a fresh subtrie is cheaper to build in place
+constexpr size_t PARALLEL_HASH_MIN_UPDATES = 256;
+
+bool should_build_aside_(UpdateAuxImpl const &aux, Requests const &requests)
+{
+    if (aux.hash_arena() == nullptr || std::popcount(requests.mask) < 2) {
+        return false;
+    }
+    size_t n = 0;
+    for (auto const [index, branch] : NodeChildrenRange(requests.mask)) {
+        n += requests[branch].size();
+    }
+    return n >= PARALLEL_HASH_MIN_UPDATES;
+}
+
+// Writes the descendants of `node`, built aside by create_new_trie_ with
+// `defer_writes`, children first, as create_node_from_children_if_any would
+// have as their parents were created, and frees those not cached. `sm` is
+// at the end of the path of `node`.
+void write_subtrie_built_aside_(
+    UpdateAuxImpl &aux, StateMachine &sm, Node &node)
+{
+    auto const number_of_children = node.number_of_children();
+    for (auto const [index, branch] : NodeChildrenRange(node.mask)) {
+        Node *const child = node.next(index);
+        MONAD_ASSERT(child != nullptr);
+        MONAD_ASSERT(node.fnext(index) == INVALID_OFFSET);
+        auto const child_path = child->path_nibble_view();
+        sm.down(branch);
+        for (unsigned i = 0; i < child_path.nibble_size(); ++i) {
+            sm.down(child_path.get(i));
+        }
+        write_subtrie_built_aside_(aux, sm, *child);
+        aux.collect_number_nodes_created_stats();
+        auto const offset = async_write_node_set_spare(aux, *child, true);
+        auto const [min_offset_fast, min_offset_slow] =
+            calc_min_offsets(*child, aux.physical_to_virtual(offset));
+        node.set_fnext(index, offset);
+        node.set_min_offset_fast(index, min_offset_fast);
+        node.set_min_offset_slow(index, min_offset_slow);
+        if (number_of_children > 1 && !sm.cache()) {
+            node.move_next(index).reset();
+        }
+        sm.up(1 + child_path.nibble_size());
+    }
+}
+
+// Builds and hashes the subtries of `requests` on the hashing threads, each
+// with its own state machine. Nodes are in memory only until the upserting
+// thread writes them, unless the caller is itself building aside.
+void build_subtries_aside_(
+    UpdateAuxImpl &aux, StateMachine &sm, int64_t &parent_version,
+    std::span<ChildData> const children, Requests &requests,
+    unsigned const prefix_index, bool const defer_writes)
+{
+    std::vector<int64_t> versions(children.size(), parent_version);
+    aux.hash_arena()->execute([&] {
+        oneapi::tbb::task_group group;
+        for (auto const [index, branch] : NodeChildrenRange(requests.mask)) {
+            children[index].branch = branch;
+            group.run([&, index = index, branch = branch] {
+                auto const child_sm = sm.clone();
+                child_sm->down(branch);
+                create_new_trie_(
+                    aux,
+                    *child_sm,
+                    versions[index],
+                    children[index],
+                    std::move(requests)[branch],
+                    prefix_index + 1,
+                    true);
+            });
+        }
+        group.wait();
+    });
+    for (auto const [index, branch] : NodeChildrenRange(requests.mask)) {
+        parent_version = std::max(parent_version, versions[index]);
+        ChildData const &child = children[index];
+        if (aux.is_on_disk() && !defer_writes && child.ptr) {
+            auto const child_path = child.ptr->path_nibble_view();
+            sm.down(branch);
+            for (unsigned i = 0; i < child_path.nibble_size(); ++i) {
+                sm.down(child_path.get(i));
+            }
+            write_subtrie_built_aside_(aux, sm, *child.ptr);
+            sm.up(1 + child_path.nibble_size());
+        }
+    }
+}
+
 void create_new_trie_(
     UpdateAuxImpl &aux, StateMachine &sm, int64_t &parent_version,
-    ChildData &entry, UpdateList &&updates, unsigned prefix_index)
+    ChildData &entry, UpdateList &&updates, unsigned prefix_index,
+    bool const defer_writes)
 {
     if (updates.empty()) {
         return;
@@ -932,7 +1034,8 @@ void create_new_trie_(
             path,
             0,
             update.value,
-            update.version);
+            update.version,
+            defer_writes);
 
         if (path.nibble_size()) {
             sm.up(path.nibble_size());
@@ -970,7 +1073,8 @@ void create_new_trie_(
             prefix_index_start, prefix_index - prefix_index_start),
         prefix_index,
         requests.opt_leaf.and_then(&Update::value),
-        requests.opt_leaf.has_value() ? requests.opt_leaf.value().version : 0);
+        requests.opt_leaf.has_value() ? requests.opt_leaf.value().version : 0,
+        defer_writes);
     if (prefix_index_start != prefix_index) {
         sm.up(prefix_index - prefix_index_start);
     }
@@ -980,26 +1084,42 @@ void create_new_trie_from_requests_(
     UpdateAuxImpl &aux, StateMachine &sm, int64_t &parent_version,
     ChildData &entry, Requests &requests, NibblesView const path,
     unsigned const prefix_index,
-    std::optional<byte_string_view> const opt_leaf_data, int64_t version)
+    std::optional<byte_string_view> const opt_leaf_data, int64_t version,
+    bool const defer_writes)
 {
     // version will be updated bottom up
     uint16_t const mask = requests.mask;
     std::vector<ChildData> children(size_t(std::popcount(mask)));
-    for (auto const [index, branch] : NodeChildrenRange(mask)) {
-        children[index].branch = branch;
-        sm.down(branch);
-        create_new_trie_(
-            aux,
-            sm,
-            version,
-            children[index],
-            std::move(requests)[branch],
-            prefix_index + 1);
-        sm.up(1);
+    if (should_build_aside_(aux, requests)) {
+        build_subtries_aside_(
+            aux, sm, version, children, requests, prefix_index, defer_writes);
+    }
+    else {
+        for (auto const [index, branch] : NodeChildrenRange(mask)) {
+            children[index].branch = branch;
+            sm.down(branch);
+            create_new_trie_(
+                aux,
+                sm,
+                version,
+                children[index],
+                std::move(requests)[branch],
+                prefix_index + 1,
+                defer_writes);
+            sm.up(1);
+        }
     }
     // can have empty children
     auto node = create_node_from_children_if_any(
-        aux, sm, mask, mask, children, path, opt_leaf_data, version);
+        aux,
+        sm,
+        mask,
+        mask,
+        children,
+        path,
+        opt_leaf_data,
+        version,
+        defer_writes);
     MONAD_ASSERT(node);
     parent_version = std::max(parent_version, node->version);
     entry.finalize(std::move(node), sm.get_compute(), sm.cache());
@@ -17,6 +17,7 @@
 
 #include <category/async/config.hpp>
 #include <category/core/bytes.hpp>
+#include <category/core/cpu_relax.h>
 #include <category/core/lru/static_lru_cache.hpp>
 #include <category/mpt/compute.hpp>
 #include <category/mpt/config.hpp>
@@ -44,10 +45,13 @@
     #pragma clang diagnostic pop
 #endif
 
+#include <oneapi/tbb/task_arena.h>
+
 #include <atomic>
 #include <bit>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <vector>
 
@@ -180,6 +184,7 @@ class UpdateAuxImpl
 {
     uint32_t initial_insertion_count_on_pool_creation_{0};
     bool enable_dynamic_history_length_{true};
+    std::unique_ptr<oneapi::tbb::task_arena> hash_arena_{};
 
     struct db_metadata_
     {
@@ -239,6 +244,9 @@ class UpdateAuxImpl
                                               // currently upserting
     bool alternate_slow_fast_writer_{false};
     bool can_write_to_fast_{true};
+    // count of walks in progress, and whether the io thread excludes them
+    mutable std::atomic<uint32_t> walkers_{0};
+    static constexpr uint32_t WALKS_EXCLUDED = 1u << 31;
 
     virtual void lock_unique_() const = 0;
 
@@ -539,6 +547,87 @@ public:
                *current_upsert_tid_ == get_tl_tid();
     }
 
+    // CACHED FIND
+    // Threads other than the io thread may walk the nodes in memory between
+    // try_begin_walk() and end_walk(), if try_begin_walk() returned true.
+    // The io thread sets, moves and frees nodes on behalf of other threads
+    // under exclude_walks(), which waits for the walks in progress, and no
+    // walk begins until it is released. Nested exclusions are no-ops.
+    bool try_begin_walk() const noexcept
+    {
+        if (walkers_.fetch_add(1, std::memory_order_acquire) &
+            WALKS_EXCLUDED) {
+            walkers_.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+    void end_walk() const noexcept
+    {
+        walkers_.fetch_sub(1, std::memory_order_release);
+    }
+
+    auto exclude_walks() const
+    {
+        class holder
+        {
+            friend class MONAD_MPT_NAMESPACE::UpdateAuxImpl;
+            UpdateAuxImpl const *parent_;
+
+            explicit holder(UpdateAuxImpl const *parent)
+                : parent_(parent)
+            {
+                auto &walkers = parent_->walkers_;
+                if (walkers.fetch_or(
+                        WALKS_EXCLUDED, std::memory_order_acquire) &
+                    WALKS_EXCLUDED) {
+                    parent_ = nullptr;
+                    return;
+                }
+                while (walkers.load(std::memory_order_acquire) !=
+                       WALKS_EXCLUDED) {
+                    cpu_relax();
+                }
+            }
+
+        public:
+            holder(holder const &) = delete;
+
+            holder(holder &&o)
+                : parent_(o.parent_)
+            {
+                o.parent_ = nullptr;
+            }
+
+            holder &operator=(holder const &) = delete;
+            holder &operator=(holder &&) = delete;
+
+            ~holder()
+            {
+                if (parent_ != nullptr) {
+                    parent_->walkers_.fetch_and(
+                        ~WALKS_EXCLUDED, std::memory_order_release);
+                }
+            }
+        };
+
+        return holder{this};
+    }
+
+    // PARALLEL HASH
+    // With `n` hashing threads, the upserting thread hands the large fresh
+    // subtries of an upsert, such as the storage of new accounts or the
+    // tables rebuilt every block, to them to build and hash. Their nodes
+    // are written to disk by the upserting thread, children first. Not
+    // thread safe with upserts.
+    void set_hashing_threads(unsigned n);
+
+    oneapi::tbb::task_arena *hash_arena() const noexcept
+    {
+        return hash_arena_.get();
+    }
+
     bool has_upsert_run_since() const noexcept
     {
         return current_upsert_tid_.has_value() &&
@@ -852,7 +941,7 @@ public:
 };
 
 static_assert(
-    sizeof(UpdateAuxImpl) == 160 + sizeof(detail::TrieUpdateCollectedStats));
+    sizeof(UpdateAuxImpl) == 168 + sizeof(detail::TrieUpdateCollectedStats));
 static_assert(alignof(UpdateAuxImpl) == 8);
 
 template <lockable_or_void LockType = void>
@@ -1116,6 +1205,17 @@ modifying trie.
 find_cursor_result_type find_blocking(
     UpdateAuxImpl const &, NodeCursor, NibblesView key, uint64_t version);
 
+/*! \brief find node indexed by key from root through the nodes in memory
+only, without locking. When a node along key is not in memory, it returns
+need_to_continue_in_io_thread with the cursor at the end of the path of its
+parent and `key` advanced to the branch of that node, from where the triedb
+thread can continue the find.
+
+\warning Should only invoke it between `UpdateAuxImpl::try_begin_walk()` and
+`UpdateAuxImpl::end_walk()` from a thread other than the triedb owning thread.
+*/
+find_cursor_result_type find_in_memory(NodeCursor, NibblesView &key);
+
 /* This function reads a node from the specified physical offset `node_offset`,
 where the spare bits indicate the number of pages to read. It returns a valid
 `Node::UniquePtr` on success, and returns `nullptr` if the specified version
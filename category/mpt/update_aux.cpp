@@ -41,6 +41,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <format>
+#include <memory>
 #include <random>
 #include <span>
 #include <stdexcept>
@@ -1623,6 +1624,14 @@ void UpdateAuxImpl::print_update_stats(uint64_t const version)
 #endif
 }
 
+void UpdateAuxImpl::set_hashing_threads(unsigned const n)
+{
+    // one more slot for the upserting thread, which joins the work
+    hash_arena_ =
+        n ? std::make_unique<oneapi::tbb::task_arena>(static_cast<int>(n + 1))
+          : nullptr;
+}
+
 void UpdateAuxImpl::reset_stats()
 {
     stats.reset();
@@ -23,6 +23,7 @@
 #include <category/execution/ethereum/chain/chain_config.h>
 #include <category/execution/ethereum/chain/ethereum_mainnet.hpp>
 #include <category/execution/ethereum/core/block.hpp>
+#include <category/execution/ethereum/core/recovery_cache.hpp>
 #include <category/execution/ethereum/core/rlp/address_rlp.hpp>
 #include <category/execution/ethereum/core/rlp/block_rlp.hpp>
 #include <category/execution/ethereum/core/rlp/bytes_rlp.hpp>
@@ -458,6 +459,8 @@ struct monad_eth_call_executor
 
     BlockHashCache blockhash_cache_{7200};
 
+    RecoveryCache recovery_cache_{100'000};
+
     monad_eth_call_executor(
         monad_eth_call_pool_config const &low_pool_config,
         monad_eth_call_pool_config const &high_pool_config,
@@ -586,7 +589,8 @@ struct monad_eth_call_executor
             return;
         }
 
-        auto const authorities = recover_authorities({txn}, active_pool.pool);
+        auto const authorities =
+            recover_authorities({txn}, active_pool.pool, &recovery_cache_);
         MONAD_ASSERT(authorities.size() == 1);
 
         active_pool.pool.submit(
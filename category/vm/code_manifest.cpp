@@ -0,0 +1,171 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <category/vm/code_manifest.hpp>
+
+#include <evmc/evmc.hpp>
+#include <evmc/hex.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <span>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+namespace monad::vm
+{
+    CodeManifest::CodeManifest(
+        std::filesystem::path dir, Hasher const hasher,
+        size_t const max_entries)
+        : dir_{std::move(dir)}
+        , hasher_{hasher}
+        , max_entries_{max_entries}
+    {
+    }
+
+    std::filesystem::path CodeManifest::dir(uint64_t const traits_id) const
+    {
+        return dir_ / std::format("v{}-{}", COMPILER_VERSION, traits_id);
+    }
+
+    void CodeManifest::record(
+        uint64_t const traits_id, evmc::bytes32 const &code_hash,
+        std::span<uint8_t const> const code)
+    {
+        std::error_code ec;
+        auto const dir = this->dir(traits_id);
+        auto const path = dir / evmc::hex(code_hash);
+        // the kernel sets coarse timestamps, set a precise one to order the
+        // entries
+        auto const touch = [&] {
+            std::filesystem::last_write_time(
+                path, std::filesystem::file_time_type::clock::now(), ec);
+        };
+        if (std::filesystem::exists(path, ec)) {
+            // compiled again, e.g. after its eviction from the varcode cache
+            touch();
+            return;
+        }
+        std::filesystem::create_directories(dir, ec);
+        if (ec) {
+            return;
+        }
+        // unique per process and thread, another process may share `dir`
+        auto const tmp = dir / std::format(
+                                   ".{}.{}.{}",
+                                   evmc::hex(code_hash),
+                                   getpid(),
+                                   std::hash<std::thread::id>{}(
+                                       std::this_thread::get_id()));
+        {
+            std::ofstream out{tmp, std::ios::binary | std::ios::trunc};
+            out.write(
+                reinterpret_cast<char const *>(code.data()),
+                static_cast<std::streamsize>(code.size()));
+            if (!out) {
+                std::filesystem::remove(tmp, ec);
+                return;
+            }
+        }
+        std::filesystem::rename(tmp, path, ec);
+        if (ec) {
+            std::filesystem::remove(tmp, ec);
+            return;
+        }
+        touch();
+        // a trim lists the directory, amortise it over many new entries
+        size_t const trim_interval = max_entries_ / 8 + 1;
+        if ((n_new_.fetch_add(1, std::memory_order_relaxed) + 1) %
+                trim_interval ==
+            0) {
+            trim(traits_id);
+        }
+    }
+
+    std::vector<CodeManifest::File>
+    CodeManifest::files(uint64_t const traits_id) const
+    {
+        std::vector<File> files;
+        std::error_code ec;
+        for (auto const &file :
+             std::filesystem::directory_iterator{dir(traits_id), ec}) {
+            auto const code_hash = evmc::from_hex<evmc::bytes32>(
+                file.path().filename().string());
+            if (!code_hash.has_value() || !file.is_regular_file(ec)) {
+                continue;
+            }
+            auto const time = file.last_write_time(ec);
+            if (ec) {
+                continue;
+            }
+            files.emplace_back(time, file.path());
+        }
+        std::sort(files.begin(), files.end(), std::greater<>{});
+        return files;
+    }
+
+    void CodeManifest::trim(uint64_t const traits_id) const
+    {
+        auto const files = this->files(traits_id);
+        std::error_code ec;
+        for (size_t i = max_entries_; i < files.size(); ++i) {
+            std::filesystem::remove(files[i].second, ec);
+        }
+    }
+
+    std::vector<evmc::bytes32>
+    CodeManifest::list(uint64_t const traits_id) const
+    {
+        auto const files = this->files(traits_id);
+        std::vector<evmc::bytes32> code_hashes;
+        code_hashes.reserve(std::min(files.size(), max_entries_));
+        for (size_t i = 0; i < files.size() && i < max_entries_; ++i) {
+            code_hashes.push_back(*evmc::from_hex<evmc::bytes32>(
+                files[i].second.filename().string()));
+        }
+        return code_hashes;
+    }
+
+    std::optional<std::vector<uint8_t>> CodeManifest::read(
+        uint64_t const traits_id, evmc::bytes32 const &code_hash) const
+    {
+        std::error_code ec;
+        auto const path = dir(traits_id) / evmc::hex(code_hash);
+        auto const size = std::filesystem::file_size(path, ec);
+        if (ec || size > MAX_CODE_SIZE) {
+            return std::nullopt;
+        }
+        std::ifstream in{path, std::ios::binary};
+        std::vector<uint8_t> code(size);
+        in.read(
+            reinterpret_cast<char *>(code.data()),
+            static_cast<std::streamsize>(code.size()));
+        if (!in || hasher_(code) != code_hash) {
+            return std::nullopt;
+        }
+        return code;
+    }
+}
@@ -0,0 +1,98 @@
+// Copyright (C) 2025 Category Labs, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#pragma once
+
+#include <evmc/evmc.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace monad::vm
+{
+    /// Content-addressed store of the bytecode of compiled contracts, so
+    /// that a process can compile them ahead of execution after a restart
+    /// instead of interpreting them until they get hot again.
+    ///
+    /// Native code itself is not stored: the code emitted by asmjit holds
+    /// absolute addresses of runtime functions and of the JIT memory of the
+    /// process that emitted it. Entries are keyed by code hash, traits id
+    /// and compiler version, and the bytecode is stored with them so that
+    /// loading does not need the database. Loaded bytecode is checked
+    /// against its code hash. Writes are atomic renames, so several
+    /// processes can share a directory.
+    ///
+    /// The manifest keeps the `max_entries` contracts most recently
+    /// compiled per traits id. Recording a contract that is already there
+    /// refreshes it, and older entries are removed as new ones come in.
+    class CodeManifest
+    {
+    public:
+        /// Bump when the compiler changes so that recorded contracts are
+        /// worth compiling under different criteria.
+        static constexpr uint32_t COMPILER_VERSION = 1;
+
+        /// Largest bytecode loaded back.
+        static constexpr size_t MAX_CODE_SIZE = 1 << 20;
+
+        static constexpr size_t DEFAULT_MAX_ENTRIES = 10'000;
+
+        /// Code hash function, keccak256 of the bytecode.
+        using Hasher = evmc::bytes32 (*)(std::span<uint8_t const>);
+
+        CodeManifest(
+            std::filesystem::path dir, Hasher hasher,
+            size_t max_entries = DEFAULT_MAX_ENTRIES);
+
+        /// Record the bytecode of `code_hash`, compiled with traits
+        /// `traits_id`. Only refreshes the entry if it is already recorded.
+        /// Errors are ignored, the manifest is a cache.
+        void record(
+            uint64_t traits_id, evmc::bytes32 const &code_hash,
+            std::span<uint8_t const> code);
+
+        /// Code hashes of the contracts recorded for `traits_id`, most
+        /// recently compiled first, at most `max_entries`.
+        std::vector<evmc::bytes32> list(uint64_t traits_id) const;
+
+        /// Bytecode of a listed contract, if it is still recorded and
+        /// matches its code hash.
+        std::optional<std::vector<uint8_t>>
+        read(uint64_t traits_id, evmc::bytes32 const &code_hash) const;
+
+    private:
+        using File = std::pair<
+            std::filesystem::file_time_type, std::filesystem::path>;
+
+        std::filesystem::path dir(uint64_t traits_id) const;
+
+        /// The files of the entries of `traits_id`, most recent first.
+        std::vector<File> files(uint64_t traits_id) const;
+
+        /// Remove the entries of `traits_id` beyond `max_entries`.
+        void trim(uint64_t traits_id) const;
+
+        std::filesystem::path dir_;
+        Hasher hasher_;
+        size_t max_entries_;
+        /// new entries since the last trim
+        std::atomic<size_t> n_new_{0};
+    };
+}
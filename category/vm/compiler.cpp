@@ -25,9 +25,13 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <span>
 #include <thread>
 #include <variant>
+#include <vector>
 
 namespace monad::vm
 {
@@ -69,9 +73,9 @@ namespace monad::vm
     EXPLICIT_TRAITS_MEMBER(Compiler::compile);
 
     template <Traits traits>
-    SharedNativecode Compiler::cached_compile(
+    SharedNativecode Compiler::compile_and_cache(
         evmc::bytes32 const &code_hash, SharedIntercode const &icode,
-        CompilerConfig const &config)
+        CompilerConfig const &config, bool const record)
     {
         if (auto vcode = varcode_cache_.get(code_hash)) {
             auto const &ncode = (*vcode)->nativecode();
@@ -84,9 +88,21 @@ namespace monad::vm
         auto const end = std::chrono::steady_clock::now();
         varcode_cache_.set(code_hash, icode, ncode);
         stats_.event_new_compiled_code_cached(icode, ncode, start, end);
+        if (record && code_manifest_ &&
+            ncode->error_code() == Nativecode::ErrorCode::NoError) {
+            code_manifest_->record(traits::id(), code_hash, icode->code_span());
+        }
         return ncode;
     }
 
+    template <Traits traits>
+    SharedNativecode Compiler::cached_compile(
+        evmc::bytes32 const &code_hash, SharedIntercode const &icode,
+        CompilerConfig const &config)
+    {
+        return compile_and_cache<traits>(code_hash, icode, config, true);
+    }
+
     EXPLICIT_TRAITS_MEMBER(Compiler::cached_compile);
 
     template <Traits traits>
@@ -126,6 +142,55 @@ namespace monad::vm
 
     EXPLICIT_TRAITS_MEMBER(Compiler::async_compile);
 
+    template <Traits traits>
+    void Compiler::warm_up_from(
+        std::shared_ptr<std::vector<evmc::bytes32> const> const &code_hashes,
+        size_t const i, CompilerConfig const &config)
+    {
+        // Stop once the varcode cache is warm, warmed up contracts should
+        // not evict each other. One contract per job: only its bytecode is
+        // in memory, and compile jobs of hot contracts run in between.
+        if (i == code_hashes->size() || varcode_cache_.is_warm()) {
+            return;
+        }
+        auto const &code_hash = (*code_hashes)[i];
+        if (auto const code = code_manifest_->read(traits::id(), code_hash)) {
+            // not recorded again, that would reverse the order of the
+            // entries
+            compile_and_cache<traits>(
+                code_hash,
+                make_shared_intercode(std::span<uint8_t const>{*code}),
+                config,
+                false);
+        }
+        warm_up_queue_.push([this, code_hashes, i, config] {
+            warm_up_from<traits>(code_hashes, i + 1, config);
+        });
+    }
+
+    template <Traits traits>
+    void Compiler::warm_up(CompilerConfig const &config)
+    {
+        static_assert(traits::id() < 64);
+        uint64_t const bit = uint64_t{1} << traits::id();
+        if (!code_manifest_ || !enable_async_compilation_ ||
+            (warmed_up_traits_.fetch_or(bit, std::memory_order_acq_rel) &
+             bit)) {
+            return;
+        }
+        // the manifest is read on the compile thread too
+        warm_up_queue_.push([this, config] {
+            warm_up_from<traits>(
+                std::make_shared<std::vector<evmc::bytes32> const>(
+                    code_manifest_->list(traits::id())),
+                0,
+                config);
+        });
+        compile_job_cv_.notify_all();
+    }
+
+    EXPLICIT_TRAITS_MEMBER(Compiler::warm_up);
+
     void Compiler::compile_loop()
     {
         while (!stop_flag_.test(std::memory_order_acquire)) {
@@ -139,6 +204,17 @@ namespace monad::vm
             compile_job_cv_.wait_for(
                 compile_job_lock_, std::chrono::milliseconds{1});
             dispense_compile_jobs();
+            dispense_warm_up_jobs();
+        }
+    }
+
+    void Compiler::dispense_warm_up_jobs()
+    {
+        std::function<void()> job;
+        while (compile_job_queue_.empty() &&
+               !stop_flag_.test(std::memory_order_acquire) &&
+               warm_up_queue_.try_pop(job)) {
+            job();
         }
     }
 
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <category/vm/code.hpp>
+#include <category/vm/code_manifest.hpp>
 #include <category/vm/compiler/ir/x86.hpp>
 #include <category/vm/evm/traits.hpp>
 #include <category/vm/utils/debug.hpp>
@@ -33,7 +34,10 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <functional>
+#include <memory>
 #include <thread>
+#include <vector>
 
 namespace monad::vm
 {
@@ -148,6 +152,7 @@ namespace monad::vm
             utils::Hash32Compare>;
         using CompileJobAccessor = CompileJobMap::accessor;
         using CompileJobQueue = tbb::concurrent_queue<evmc::bytes32>;
+        using WarmUpQueue = tbb::concurrent_queue<std::function<void()>>;
 
     public:
         explicit Compiler(
@@ -175,6 +180,20 @@ namespace monad::vm
             evmc::bytes32 const &code_hash, SharedIntercode const &,
             CompilerConfig const & = {});
 
+        /// Record the contracts compiled from now on in `manifest`. Must be
+        /// called before any compilation.
+        void set_code_manifest(std::unique_ptr<CodeManifest> manifest)
+        {
+            code_manifest_ = std::move(manifest);
+        }
+
+        /// Compile the contracts recorded in the code manifest for
+        /// `revision`, once, in the background, most recently compiled
+        /// first, until the varcode cache is warm. Compile jobs of hot
+        /// contracts take precedence.
+        template <Traits traits>
+        void warm_up(CompilerConfig const & = {});
+
         /// Lookup in the cache.
         std::optional<SharedVarcode>
         find_varcode(evmc::bytes32 const &code_hash)
@@ -212,6 +231,21 @@ namespace monad::vm
         void stop_compile_thread();
         void compile_loop();
         void dispense_compile_jobs();
+        void dispense_warm_up_jobs();
+
+        /// `cached_compile`, recording the contract in the code manifest
+        /// only if `record`.
+        template <Traits traits>
+        SharedNativecode compile_and_cache(
+            evmc::bytes32 const &code_hash, SharedIntercode const &,
+            CompilerConfig const &, bool record);
+
+        /// Warm up the contracts from `code_hashes[i]` on, one per job.
+        template <Traits traits>
+        void warm_up_from(
+            std::shared_ptr<std::vector<evmc::bytes32> const> const &
+                code_hashes,
+            size_t i, CompilerConfig const &);
 
         static constexpr asmjit::JitAllocator::CreateParams
             asmjit_create_params_{
@@ -222,6 +256,9 @@ namespace monad::vm
         VarcodeCache varcode_cache_;
         CompileJobMap compile_job_map_;
         CompileJobQueue compile_job_queue_;
+        std::unique_ptr<CodeManifest> code_manifest_;
+        WarmUpQueue warm_up_queue_;
+        std::atomic<uint64_t> warmed_up_traits_{0};
         std::condition_variable compile_job_cv_;
         std::mutex compile_job_mutex_;
         std::unique_lock<std::mutex> compile_job_lock_;
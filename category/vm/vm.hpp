@@ -155,6 +155,13 @@ namespace monad::vm
             return compiler_config_;
         }
 
+        /// See `Compiler::warm_up`.
+        template <Traits traits>
+        void warm_up()
+        {
+            compiler_.warm_up<traits>(compiler_config_);
+        }
+
         /// Execute varcode. The function will execute the nativecode in
         /// the varcode if set. Otherwise execute the intercode with
         /// interpreter and potentially start async compilation.
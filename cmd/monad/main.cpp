@@ -19,8 +19,12 @@
 
 #include <category/core/assert.h>
 #include <category/core/basic_formatter.hpp>
+#include <category/core/byte_string.hpp>
+#include <category/core/bytes.hpp>
 #include <category/core/config.hpp>
+#include <category/core/cpuset.h>
 #include <category/core/fiber/priority_pool.hpp>
+#include <category/core/keccak.hpp>
 #include <category/core/likely.h>
 #include <category/core/monad_exception.hpp>
 #include <category/core/procfs/statm.h>
@@ -47,6 +51,7 @@
 #include <category/statesync/statesync_server.h>
 #include <category/statesync/statesync_server_context.hpp>
 #include <category/statesync/statesync_server_network.hpp>
+#include <category/vm/code_manifest.hpp>
 #include <category/vm/vm.hpp>
 
 #include <CLI/CLI.hpp>
@@ -59,13 +64,17 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <exception>
 #include <filesystem>
 #include <limits>
+#include <memory>
 #include <optional>
+#include <sched.h>
 #include <signal.h>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <sys/sysinfo.h>
@@ -126,14 +135,23 @@ try {
     uint64_t nblocks = std::numeric_limits<uint64_t>::max();
     unsigned nthreads = 4;
     unsigned nfibers = 256;
+    std::string worker_cpus;
+    size_t prefetch_budget = 16'384;
+    size_t state_cache_mb = DbCache::DEFAULT_BUDGET >> 20;
+    unsigned hashing_threads = 0;
+    unsigned read_threads = 0;
     bool no_compaction = false;
     bool trace_calls = false;
+    bool conflict_scheduling = false;
     std::string exec_event_ring_config;
     unsigned sq_thread_cpu = static_cast<unsigned>(get_nprocs() - 1);
     unsigned ro_sq_thread_cpu = static_cast<unsigned>(get_nprocs() - 2);
     std::vector<fs::path> dbname_paths;
     fs::path snapshot;
     fs::path dump_snapshot;
+    fs::path code_cache_dir;
+    fs::path hot_set;
+    uint64_t hot_set_interval = 10'000;
     std::string statesync;
     auto log_level = quill::LogLevel::Info;
 
@@ -154,6 +172,49 @@ try {
         ->transform(CLI::CheckedTransformer(log_level_map, CLI::ignore_case));
     cli.add_option("--nthreads", nthreads, "number of threads");
     cli.add_option("--nfibers", nfibers, "number of fibers");
+    cli.add_option(
+        "--worker_cpus",
+        worker_cpus,
+        "cpu list (e.g. 0-15,32-47) to pin the worker threads to, one cpu "
+        "per thread; pick the cpus of one NUMA node to keep execution on it")
+        ->check([](std::string const &s) -> std::string {
+            cpu_set_t cpus;
+            if (monad_try_parse_cpuset(s.c_str(), &cpus) != 0) {
+                return "invalid cpu list";
+            }
+            cpu_set_t allowed;
+            if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+                return "could not read the cpus allowed for the process";
+            }
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                if (CPU_ISSET(cpu, &cpus) && !CPU_ISSET(cpu, &allowed)) {
+                    return "cpu " + std::to_string(cpu) +
+                           " is not allowed for the process";
+                }
+            }
+            return "";
+        });
+    cli.add_option(
+        "--prefetch_budget",
+        prefetch_budget,
+        "max number of accounts and storage slots prefetched per block, 0 "
+        "disables prefetching");
+    cli.add_option(
+           "--state_cache_mb",
+           state_cache_mb,
+           "memory in MiB of the account and storage caches, split between "
+           "them by their hit rates")
+        ->check(CLI::Range(size_t{16}, size_t{1} << 24));
+    cli.add_option(
+        "--hashing_threads",
+        hashing_threads,
+        "threads building and hashing the large new subtries of a block "
+        "commit, such as the storage of new contracts, in parallel");
+    cli.add_option(
+        "--read_threads",
+        read_threads,
+        "threads reading state from the db, each with its own io_uring, "
+        "alongside the thread that writes it");
     cli.add_flag("--no-compaction", no_compaction, "disable compaction");
     cli.add_option(
         "--sq_thread_cpu",
@@ -175,6 +236,26 @@ try {
         dump_snapshot,
         "directory to dump state to at the end of run");
     cli.add_flag("--trace_calls", trace_calls, "enable call tracing");
+    cli.add_option(
+        "--code_cache_dir",
+        code_cache_dir,
+        "directory recording the compiled contracts, which are compiled "
+        "again ahead of execution on restart; may be shared by processes");
+    cli.add_option(
+        "--hot_set",
+        hot_set,
+        "file recording the keys of the state caches, saved on shutdown and "
+        "read back into the caches on start");
+    cli.add_option(
+        "--hot_set_interval",
+        hot_set_interval,
+        "number of finalized blocks between saves of the hot set, 0 saves it "
+        "on shutdown only");
+    cli.add_flag(
+        "--conflict_scheduling",
+        conflict_scheduling,
+        "hold back transactions predicted to conflict until their "
+        "predecessor merged");
     auto *const group =
         cli.add_option_group("load", "methods to initialize the db");
     group
@@ -283,7 +364,9 @@ try {
                     .wr_buffers = 32,
                     .uring_entries = 128,
                     .sq_thread_cpu = sq_thread_cpu,
-                    .dbname_paths = dbname_paths}};
+                    .dbname_paths = dbname_paths,
+                    .hashing_threads = hashing_threads,
+                    .read_threads = read_threads}};
         }
         machine = std::make_unique<InMemoryMachine>();
         return mpt::Db{*machine};
@@ -381,7 +464,13 @@ try {
         start_block_num,
         nblocks);
 
-    fiber::PriorityPool priority_pool{nthreads, nfibers};
+    std::optional<cpu_set_t> pool_cpus;
+    if (!worker_cpus.empty()) {
+        cpu_set_t cpus;
+        MONAD_ASSERT(monad_try_parse_cpuset(worker_cpus.c_str(), &cpus) == 0);
+        pool_cpus = cpus;
+    }
+    fiber::PriorityPool priority_pool{nthreads, nfibers, false, pool_cpus};
 
     auto const start_time = std::chrono::steady_clock::now();
 
@@ -419,8 +508,24 @@ try {
     // compilation: the compiler does not expose the full fidelity of error exit
     // codes that are required to serve RPC responses that include call traces.
     vm::VM vm{!trace_calls};
+    if (!code_cache_dir.empty()) {
+        vm.compiler().set_code_manifest(std::make_unique<vm::CodeManifest>(
+            code_cache_dir, [](std::span<uint8_t const> const code) {
+                return to_bytes(
+                    keccak256(byte_string_view{code.data(), code.size()}));
+            }));
+    }
 
-    DbCache db_cache = ctx ? DbCache{*ctx} : DbCache{triedb};
+    size_t const state_cache_budget = state_cache_mb << 20;
+    DbCache db_cache = ctx ? DbCache{*ctx, state_cache_budget}
+                           : DbCache{triedb, state_cache_budget};
+    if (!hot_set.empty()) {
+        db_cache.set_block_and_prefix(init_block_num);
+        if (!db_cache.warm_up(hot_set, priority_pool, vm).has_value()) {
+            LOG_INFO("No hot set in {}, starting with cold caches", hot_set);
+        }
+        db_cache.set_hot_set_autosave(hot_set, hot_set_interval);
+    }
     auto const result = [&] {
         switch (chain_config) {
         case CHAIN_CONFIG_ETHEREUM_MAINNET:
@@ -434,7 +539,9 @@ try {
                 block_num,
                 end_block_num,
                 stop,
-                trace_calls);
+                trace_calls,
+                prefetch_budget,
+                conflict_scheduling);
         case CHAIN_CONFIG_MONAD_DEVNET:
         case CHAIN_CONFIG_MONAD_TESTNET:
         case CHAIN_CONFIG_MONAD_MAINNET:
@@ -450,7 +557,9 @@ try {
                 block_num,
                 end_block_num,
                 stop,
-                trace_calls);
+                trace_calls,
+                prefetch_budget,
+                conflict_scheduling);
         }
         MONAD_ABORT_PRINTF("Unsupported chain");
     }();
@@ -484,6 +593,10 @@ try {
             vm.print_total_counts());
     }
 
+    if (!hot_set.empty()) {
+        db_cache.save_hot_set(hot_set);
+    }
+
     if (sync != nullptr) {
         sync_thread.request_stop();
         sync_thread.join();
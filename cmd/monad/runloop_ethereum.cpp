@@ -23,7 +23,9 @@
 #include <category/core/procfs/statm.h>
 #include <category/execution/ethereum/block_hash_buffer.hpp>
 #include <category/execution/ethereum/chain/chain.hpp>
+#include <category/execution/ethereum/conflict_predictor.hpp>
 #include <category/execution/ethereum/core/block.hpp>
+#include <category/execution/ethereum/core/recovery_cache.hpp>
 #include <category/execution/ethereum/core/rlp/block_rlp.hpp>
 #include <category/execution/ethereum/db/block_db.hpp>
 #include <category/execution/ethereum/db/db.hpp>
@@ -31,6 +33,7 @@
 #include <category/execution/ethereum/execute_transaction.hpp>
 #include <category/execution/ethereum/metrics/block_metrics.hpp>
 #include <category/execution/ethereum/state2/block_state.hpp>
+#include <category/execution/ethereum/state2/state_prefetcher.hpp>
 #include <category/execution/ethereum/trace/call_tracer.hpp>
 #include <category/execution/ethereum/validate_block.hpp>
 #include <category/execution/ethereum/validate_transaction.hpp>
@@ -42,7 +45,10 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <vector>
 
 MONAD_ANONYMOUS_NAMESPACE_BEGIN
@@ -83,7 +89,9 @@ Result<void> process_ethereum_block(
     Chain const &chain, Db &db, vm::VM &vm,
     BlockHashBufferFinalized &block_hash_buffer,
     fiber::PriorityPool &priority_pool, Block &block, bytes32_t const &block_id,
-    bytes32_t const &parent_block_id, bool const enable_tracing)
+    bytes32_t const &parent_block_id, bool const enable_tracing,
+    size_t const prefetch_budget, ConflictPredictor *const conflict_predictor,
+    SenderRecovery &sender_recovery, std::function<void()> const &prepare_next)
 {
     [[maybe_unused]] auto const block_start = std::chrono::system_clock::now();
     auto const block_begin = std::chrono::steady_clock::now();
@@ -92,15 +100,26 @@ Result<void> process_ethereum_block(
     BOOST_OUTCOME_TRY(chain.static_validate_header(block.header));
     BOOST_OUTCOME_TRY(static_validate_block<traits>(block));
 
-    // Sender and authority recovery
-    auto const sender_recovery_begin = std::chrono::steady_clock::now();
-    auto const recovered_senders =
-        recover_senders(block.transactions, priority_pool);
-    auto const recovered_authorities =
-        recover_authorities(block.transactions, priority_pool);
+    // Compile the contracts recorded by a previous run, once per revision
+    vm.warm_up<traits>();
+
+    // State prefetch: reads of the state the block is known to touch are
+    // issued ahead of execution, overlapping sender recovery
+    db.set_block_and_prefix(block.header.number - 1, parent_block_id);
+    BlockState block_state(db, vm);
+    StatePrefetcher prefetcher{block_state, priority_pool, prefetch_budget};
+    prefetcher.prefetch(block);
+
+    // Sender and authority recovery, usually started while the previous
+    // block was committing
+    auto const &recovered_senders = sender_recovery.senders();
+    auto const &recovered_authorities = sender_recovery.authorities();
     [[maybe_unused]] auto const sender_recovery_time =
-        std::chrono::duration_cast<std::chrono::microseconds>(
-            std::chrono::steady_clock::now() - sender_recovery_begin);
+        sender_recovery.recovery_time();
+    [[maybe_unused]] auto const sender_recovery_stall =
+        sender_recovery.stall_time();
+    [[maybe_unused]] auto const sender_recovery_hits =
+        sender_recovery.num_cache_hits();
     std::vector<Address> senders(block.transactions.size());
     for (unsigned i = 0; i < recovered_senders.size(); ++i) {
         if (recovered_senders[i].has_value()) {
@@ -110,6 +129,10 @@ Result<void> process_ethereum_block(
             return TransactionError::MissingSender;
         }
     }
+    prefetcher.prefetch(senders, recovered_authorities);
+    auto const predecessors =
+        conflict_predictor ? conflict_predictor->predict(block, senders)
+                           : std::vector<std::optional<uint64_t>>{};
 
     // Call tracer initialization
     std::vector<std::vector<CallFrame>> call_frames{block.transactions.size()};
@@ -126,9 +149,7 @@ Result<void> process_ethereum_block(
 
     // Core execution: transaction-level EVM execution that tracks state
     // changes but does not commit them
-    db.set_block_and_prefix(block.header.number - 1, parent_block_id);
     BlockMetrics block_metrics;
-    BlockState block_state(db, vm);
     BOOST_OUTCOME_TRY(
         auto const receipts,
         execute_block<traits>(
@@ -140,7 +161,23 @@ Result<void> process_ethereum_block(
             block_hash_buffer,
             priority_pool,
             block_metrics,
-            call_tracers));
+            call_tracers,
+            no_revert_transaction,
+            predecessors));
+    if (conflict_predictor) {
+        conflict_predictor->update(block, block_metrics);
+    }
+    prefetcher.wait();
+    block_metrics.set_num_prefetched(prefetcher.num_prefetched());
+
+    // Preparation of the next block: it is read and its sender recovery
+    // runs on the fiber pool while this block commits. Its state prefetch
+    // can only start once this commit is done, since it reads on top of it.
+    auto const prepare_begin = std::chrono::steady_clock::now();
+    prepare_next();
+    [[maybe_unused]] auto const prepare_time =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - prepare_begin);
 
     // Database commit of state changes (incl. Merkle root calculations)
     block_state.log_debug();
@@ -179,7 +216,9 @@ Result<void> process_ethereum_block(
         "__exec_block,bl={:8},ts={}"
         ",tx={:5},rt={:4},rtp={:5.2f}%"
         ",sr={:>7},txe={:>8},cmt={:>8},tot={:>8},tpse={:5},tps={:5}"
-        ",gas={:9},gpse={:4},gps={:3}{}{}{}",
+        ",gas={:9},gpse={:4},gps={:3},pf={:>6},hit={:>7},miss={:>6}"
+        ",dup={:>5},srs={:>7},nxt={:>7},hd={:>5},srh={:>5}"
+        ",ser={:>7}{}{}{}",
         block.header.number,
         std::chrono::duration_cast<std::chrono::milliseconds>(
             block_start.time_since_epoch())
@@ -200,6 +239,15 @@ Result<void> process_ethereum_block(
         output_header.gas_used /
             (uint64_t)std::max(1L, block_metrics.tx_exec_time().count()),
         output_header.gas_used / (uint64_t)std::max(1L, block_time.count()),
+        block_metrics.num_prefetched(),
+        block_metrics.num_read_hits(),
+        block_metrics.num_read_misses(),
+        block_metrics.num_reads_coalesced(),
+        sender_recovery_stall,
+        prepare_time,
+        block_metrics.num_held(),
+        sender_recovery_hits,
+        block_metrics.serial_time(),
         db.print_stats(),
         vm.print_and_reset_block_counts(),
         vm.print_compiler_stats());
@@ -216,7 +264,8 @@ Result<std::pair<uint64_t, uint64_t>> runloop_ethereum(
     vm::VM &vm, BlockHashBufferFinalized &block_hash_buffer,
     fiber::PriorityPool &priority_pool, uint64_t &block_num,
     uint64_t const end_block_num, sig_atomic_t const volatile &stop,
-    bool const enable_tracing)
+    bool const enable_tracing, size_t const prefetch_budget,
+    bool const conflict_scheduling)
 {
     uint64_t const batch_size =
         end_block_num == std::numeric_limits<uint64_t>::max() ? 1 : 1000;
@@ -229,12 +278,41 @@ Result<std::pair<uint64_t, uint64_t>> runloop_ethereum(
 
     BlockDb block_db(ledger_dir);
     bytes32_t parent_block_id{};
+    // PIPELINE
+    // the next block is read and its senders recovered while the current
+    // one commits
+    std::optional<Block> next_block;
+    std::unique_ptr<SenderRecovery> next_sender_recovery;
+    ConflictPredictor conflict_predictor;
+    RecoveryCache recovery_cache;
     while (block_num <= end_block_num && stop == 0) {
         Block block;
-        MONAD_ASSERT_PRINTF(
-            block_db.get(block_num, block),
-            "Could not query %lu from blockdb",
-            block_num);
+        std::unique_ptr<SenderRecovery> sender_recovery;
+        if (next_block.has_value()) {
+            block = std::move(next_block).value();
+            sender_recovery = std::move(next_sender_recovery);
+            next_block.reset();
+        }
+        else {
+            MONAD_ASSERT_PRINTF(
+                block_db.get(block_num, block),
+                "Could not query %lu from blockdb",
+                block_num);
+            sender_recovery = std::make_unique<SenderRecovery>(
+                block.transactions, priority_pool, &recovery_cache);
+        }
+        std::function<void()> const prepare_next = [&] {
+            if (block_num == end_block_num || stop != 0) {
+                return;
+            }
+            Block next;
+            if (!block_db.get(block_num + 1, next)) {
+                return;
+            }
+            next_block = std::move(next);
+            next_sender_recovery = std::make_unique<SenderRecovery>(
+                next_block->transactions, priority_pool, &recovery_cache);
+        };
 
         bytes32_t const block_id = bytes32_t{block.header.number};
         evmc_revision const rev =
@@ -251,7 +329,11 @@ Result<std::pair<uint64_t, uint64_t>> runloop_ethereum(
                 block,
                 block_id,
                 parent_block_id,
-                enable_tracing);
+                enable_tracing,
+                prefetch_budget,
+                conflict_scheduling ? &conflict_predictor : nullptr,
+                *sender_recovery,
+                prepare_next);
             MONAD_ABORT_PRINTF("unhandled rev switch case: %d", rev);
         }());
 
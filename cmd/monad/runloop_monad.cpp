@@ -16,6 +16,7 @@
 #include "runloop_monad.hpp"
 #include "file_io.hpp"
 
+#include <category/async/detail/scope_polyfill.hpp>
 #include <category/core/assert.h>
 #include <category/core/blake3.hpp>
 #include <category/core/bytes.hpp>
@@ -24,8 +25,10 @@
 #include <category/core/keccak.hpp>
 #include <category/core/procfs/statm.h>
 #include <category/execution/ethereum/block_hash_buffer.hpp>
+#include <category/execution/ethereum/conflict_predictor.hpp>
 #include <category/execution/ethereum/core/block.hpp>
 #include <category/execution/ethereum/core/fmt/bytes_fmt.hpp>
+#include <category/execution/ethereum/core/recovery_cache.hpp>
 #include <category/execution/ethereum/core/rlp/block_rlp.hpp>
 #include <category/execution/ethereum/db/db.hpp>
 #include <category/execution/ethereum/db/util.hpp>
@@ -36,6 +39,7 @@
 #include <category/execution/ethereum/execute_transaction.hpp>
 #include <category/execution/ethereum/metrics/block_metrics.hpp>
 #include <category/execution/ethereum/state2/block_state.hpp>
+#include <category/execution/ethereum/state2/state_prefetcher.hpp>
 #include <category/execution/ethereum/trace/call_tracer.hpp>
 #include <category/execution/ethereum/transaction_gas.hpp>
 #include <category/execution/ethereum/validate_block.hpp>
@@ -55,8 +59,11 @@
 #include <quill/detail/LogMacros.h>
 
 #include <chrono>
+#include <cstddef>
 #include <deque>
 #include <filesystem>
+#include <functional>
+#include <memory>
 #include <optional>
 #include <thread>
 #include <variant>
@@ -74,6 +81,30 @@ struct BlockCacheEntry
 using BlockCache =
     ankerl::unordered_dense::segmented_map<bytes32_t, BlockCacheEntry>;
 
+// PIPELINE
+// body of a block to execute with its sender recovery in flight, prepared
+// while the previous block commits
+struct PreparedBlock
+{
+    bytes32_t block_id;
+    MonadConsensusBlockBody body;
+    std::unique_ptr<SenderRecovery> sender_recovery;
+};
+
+PreparedBlock prepare_block(
+    bytes32_t const &block_id, bytes32_t const &block_body_id,
+    std::filesystem::path const &body_dir, fiber::PriorityPool &priority_pool,
+    RecoveryCache &recovery_cache)
+{
+    auto body = read_body(block_body_id, body_dir);
+    auto sender_recovery = std::make_unique<SenderRecovery>(
+        body.transactions, priority_pool, &recovery_cache);
+    return PreparedBlock{
+        .block_id = block_id,
+        .body = std::move(body),
+        .sender_recovery = std::move(sender_recovery)};
+}
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-variable"
 #pragma GCC diagnostic ignored "-Wunused-parameter"
@@ -153,10 +184,17 @@ Result<BlockExecOutput> propose_block(
     MonadConsensusBlockHeader const &consensus_header, Block block,
     BlockHashChain &block_hash_chain, MonadChain const &chain, Db &db,
     vm::VM &vm, fiber::PriorityPool &priority_pool, bool const is_first_block,
-    bool const enable_tracing, BlockCache &block_cache)
+    bool const enable_tracing, size_t const prefetch_budget,
+    ConflictPredictor *const conflict_predictor,
+    BlockCache &block_cache, SenderRecovery &sender_recovery,
+    std::function<void()> const &prepare_next)
 {
     [[maybe_unused]] auto const block_start = std::chrono::system_clock::now();
     auto const block_begin = std::chrono::steady_clock::now();
+    // the recovery reads the transactions of `block`, it has to finish
+    // before they are destroyed, also on an early return
+    auto const wait_for_recovery = make_scope_exit(
+        [&sender_recovery]() noexcept { sender_recovery.wait(); });
     auto const &block_hash_buffer =
         block_hash_chain.find_chain(consensus_header.parent_id());
 
@@ -165,15 +203,28 @@ Result<BlockExecOutput> propose_block(
     BOOST_OUTCOME_TRY(chain.static_validate_header(block.header));
     BOOST_OUTCOME_TRY(static_validate_block<traits>(block));
 
-    // Sender and EIP-7702 authorities recovery
-    auto const sender_recovery_begin = std::chrono::steady_clock::now();
-    auto const recovered_senders =
-        recover_senders(block.transactions, priority_pool);
-    auto const recovered_authorities =
-        recover_authorities(block.transactions, priority_pool);
+    // Compile the contracts recorded by a previous run, once per revision
+    vm.warm_up<traits>();
+
+    // State prefetch: reads of the state the block is known to touch are
+    // issued ahead of execution, overlapping sender recovery
+    db.set_block_and_prefix(
+        block.header.number - 1,
+        is_first_block ? bytes32_t{} : consensus_header.parent_id());
+    BlockState block_state(db, vm);
+    StatePrefetcher prefetcher{block_state, priority_pool, prefetch_budget};
+    prefetcher.prefetch(block);
+
+    // Sender and EIP-7702 authorities recovery, usually started while the
+    // previous block was committing
+    auto const &recovered_senders = sender_recovery.senders();
+    auto const &recovered_authorities = sender_recovery.authorities();
     [[maybe_unused]] auto const sender_recovery_time =
-        std::chrono::duration_cast<std::chrono::microseconds>(
-            std::chrono::steady_clock::now() - sender_recovery_begin);
+        sender_recovery.recovery_time();
+    [[maybe_unused]] auto const sender_recovery_stall =
+        sender_recovery.stall_time();
+    [[maybe_unused]] auto const sender_recovery_hits =
+        sender_recovery.num_cache_hits();
     std::vector<Address> senders(block.transactions.size());
     for (unsigned i = 0; i < recovered_senders.size(); ++i) {
         if (recovered_senders[i].has_value()) {
@@ -205,6 +256,10 @@ Result<BlockExecOutput> propose_block(
                                  std::move(senders_and_authorities)})
                      .second);
     BOOST_OUTCOME_TRY(static_validate_monad_senders<traits>(senders));
+    prefetcher.prefetch(senders, recovered_authorities);
+    auto const predecessors =
+        conflict_predictor ? conflict_predictor->predict(block, senders)
+                           : std::vector<std::optional<uint64_t>>{};
 
     // Create call frames vectors for tracers
     std::vector<std::vector<CallFrame>> call_frames{block.transactions.size()};
@@ -245,13 +300,8 @@ Result<BlockExecOutput> propose_block(
 
     // Core execution: transaction-level EVM execution that tracks state
     // changes but does not commit them
-    db.set_block_and_prefix(
-        block.header.number - 1,
-        is_first_block ? bytes32_t{} : consensus_header.parent_id());
-
     BlockExecOutput exec_output;
     BlockMetrics block_metrics;
-    BlockState block_state(db, vm);
     record_block_marker_event(MONAD_EXEC_BLOCK_PERF_EVM_ENTER);
     BOOST_OUTCOME_TRY(
         auto const results,
@@ -280,8 +330,24 @@ Result<BlockExecOutput> propose_block(
                     state,
                     chain_context);
                 return false;
-            }));
+            },
+            predecessors));
     record_block_marker_event(MONAD_EXEC_BLOCK_PERF_EVM_EXIT);
+    if (conflict_predictor) {
+        conflict_predictor->update(block, block_metrics);
+    }
+    prefetcher.wait();
+    block_metrics.set_num_prefetched(prefetcher.num_prefetched());
+
+    // Preparation of the next block: its body is read and its sender
+    // recovery runs on the fiber pool while this block commits. Its state
+    // prefetch can only start once this commit is done, since it reads on
+    // top of it.
+    auto const prepare_begin = std::chrono::steady_clock::now();
+    prepare_next();
+    [[maybe_unused]] auto const prepare_time =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - prepare_begin);
 
     // Database commit of state changes (incl. Merkle root calculations)
     block_state.log_debug();
@@ -322,7 +388,9 @@ Result<BlockExecOutput> propose_block(
         "__exec_block,bl={:8},id={},ts={}"
         ",tx={:5},rt={:4},rtp={:5.2f}%"
         ",sr={:>7},txe={:>8},cmt={:>8},tot={:>8},tpse={:5},tps={:5}"
-        ",gas={:9},gpse={:4},gps={:3}{}{}{}",
+        ",gas={:9},gpse={:4},gps={:3},pf={:>6},hit={:>7},miss={:>6}"
+        ",dup={:>5},srs={:>7},nxt={:>7},hd={:>5},srh={:>5}"
+        ",ser={:>7}{}{}{}",
         block.header.number,
         block_id,
         std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -345,6 +413,15 @@ Result<BlockExecOutput> propose_block(
             (uint64_t)std::max(1L, block_metrics.tx_exec_time().count()),
         exec_output.eth_header.gas_used /
             (uint64_t)std::max(1L, block_time.count()),
+        block_metrics.num_prefetched(),
+        block_metrics.num_read_hits(),
+        block_metrics.num_read_misses(),
+        block_metrics.num_reads_coalesced(),
+        sender_recovery_stall,
+        prepare_time,
+        block_metrics.num_held(),
+        sender_recovery_hits,
+        block_metrics.serial_time(),
         db.print_stats(),
         vm.print_and_reset_block_counts(),
         vm.print_compiler_stats());
@@ -437,7 +514,8 @@ Result<std::pair<uint64_t, uint64_t>> runloop_monad(
     BlockHashBufferFinalized &block_hash_buffer,
     fiber::PriorityPool &priority_pool, uint64_t &finalized_block_num,
     uint64_t const end_block_num, sig_atomic_t const volatile &stop,
-    bool const enable_tracing)
+    bool const enable_tracing, size_t const prefetch_budget,
+    bool const conflict_scheduling)
 {
     constexpr auto SLEEP_TIME = std::chrono::microseconds(100);
     uint64_t const start_block_num = finalized_block_num;
@@ -455,18 +533,23 @@ Result<std::pair<uint64_t, uint64_t>> runloop_monad(
     MONAD_ASSERT(last_finalized_block_number != mpt::INVALID_BLOCK_NUM);
 
     BlockCache block_cache;
+    ConflictPredictor conflict_predictor;
+    // proposals of the same transactions, e.g. on forks and re-proposals,
+    // recover their signatures once
+    RecoveryCache recovery_cache;
     for_each_header(
         finalized_head,
         header_dir,
         chain,
         last_finalized_block_number > 2 ? last_finalized_block_number - 2 : 0,
         last_finalized_block_number,
-        [&block_cache, &priority_pool, body_dir](
+        [&block_cache, &priority_pool, &recovery_cache, body_dir](
             bytes32_t const &id, auto const &header) {
             MonadConsensusBlockBody const body =
                 read_body(header.block_body_id, body_dir);
             std::vector<std::optional<Address>> const recovered =
-                recover_senders(body.transactions, priority_pool);
+                recover_senders(
+                    body.transactions, priority_pool, &recovery_cache);
             std::vector<Address> senders;
             senders.reserve(recovered.size());
             for (std::optional<Address> const &addr : recovered) {
@@ -479,7 +562,8 @@ Result<std::pair<uint64_t, uint64_t>> runloop_monad(
                 senders_and_authorities.insert(sender);
             }
             for (std::vector<std::optional<Address>> const &authorities :
-                 recover_authorities(body.transactions, priority_pool)) {
+                 recover_authorities(
+                     body.transactions, priority_pool, &recovery_cache)) {
                 for (std::optional<Address> const &authority : authorities) {
                     if (authority.has_value()) {
                         senders_and_authorities.insert(authority.value());
@@ -591,13 +675,18 @@ Result<std::pair<uint64_t, uint64_t>> runloop_monad(
              chain_id,
              start_block_num,
              enable_tracing,
+             prefetch_budget,
+             predictor = conflict_scheduling ? &conflict_predictor : nullptr,
              &block_cache](
                 bytes32_t const &block_id,
-                auto const &header) -> Result<std::pair<uint64_t, uint64_t>> {
+                auto const &header,
+                PreparedBlock &prepared_block,
+                std::function<void()> const &prepare_next)
+            -> Result<std::pair<uint64_t, uint64_t>> {
             auto const block_time_start = std::chrono::steady_clock::now();
 
             uint64_t const block_number = header.execution_inputs.number;
-            auto body = read_body(header.block_body_id, body_dir);
+            auto &body = prepared_block.body;
             auto const ntxns = body.transactions.size();
 
             auto const &block_hash_buffer =
@@ -644,7 +733,11 @@ Result<std::pair<uint64_t, uint64_t>> runloop_monad(
                     priority_pool,
                     block_number == start_block_num,
                     enable_tracing,
-                    block_cache);
+                    prefetch_budget,
+                    predictor,
+                    block_cache,
+                    *prepared_block.sender_recovery,
+                    prepare_next);
                 MONAD_ABORT_PRINTF("handled rev value %d", rev);
             };
             BOOST_OUTCOME_TRY(
@@ -663,10 +756,46 @@ Result<std::pair<uint64_t, uint64_t>> runloop_monad(
             return outcome::success();
         };
 
-        for (auto const &[block_id, consensus_header] : to_execute) {
+        // PIPELINE
+        // the next block is prepared while the current one commits
+        std::optional<PreparedBlock> prepared;
+        for (size_t i = 0; i < to_execute.size(); ++i) {
+            auto const &block_id = to_execute[i].block_id;
+            auto const &consensus_header = to_execute[i].header;
+            PreparedBlock current =
+                prepared.has_value() && prepared->block_id == block_id
+                    ? std::move(prepared).value()
+                    : std::visit(
+                          [&](auto const &header) {
+                              return prepare_block(
+                                  block_id,
+                                  header.block_body_id,
+                                  body_dir,
+                                  priority_pool,
+                                  recovery_cache);
+                          },
+                          consensus_header);
+            prepared.reset();
+            std::function<void()> const prepare_next = [&, i] {
+                if (i + 1 == to_execute.size()) {
+                    return;
+                }
+                auto const &next = to_execute[i + 1];
+                prepared = std::visit(
+                    [&](auto const &header) {
+                        return prepare_block(
+                            next.block_id,
+                            header.block_body_id,
+                            body_dir,
+                            priority_pool,
+                            recovery_cache);
+                    },
+                    next.header);
+            };
             BOOST_OUTCOME_TRY(std::visit(
-                [&block_id, handle_to_execute](auto const &header) {
-                    return handle_to_execute(block_id, header);
+                [&](auto const &header) {
+                    return handle_to_execute(
+                        block_id, header, current, prepare_next);
                 },
                 consensus_header));
         }
@@ -19,6 +19,7 @@
 #include <category/core/result.hpp>
 #include <category/vm/vm.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <utility>
@@ -44,6 +45,7 @@ namespace fiber
 Result<std::pair<uint64_t, uint64_t>> runloop_monad(
     MonadChain const &, std::filesystem::path const &, mpt::Db &, Db &,
     vm::VM &, BlockHashBufferFinalized &, fiber::PriorityPool &, uint64_t &,
-    uint64_t, sig_atomic_t const volatile &, bool enable_tracing);
+    uint64_t, sig_atomic_t const volatile &, bool enable_tracing,
+    size_t prefetch_budget, bool conflict_scheduling);
 
 MONAD_NAMESPACE_END
@@ -14,6 +14,7 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <category/vm/code.hpp>
+#include <category/vm/code_manifest.hpp>
 #include <category/vm/compiler.hpp>
 #include <category/vm/compiler/types.hpp>
 #include <category/vm/evm/opcodes.hpp>
@@ -22,6 +23,7 @@
 
 #include <evmc/evmc.h>
 #include <evmc/evmc.hpp>
+#include <evmc/hex.hpp>
 
 #include <gtest/gtest.h>
 
@@ -29,9 +31,15 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
 #include <memory>
+#include <span>
+#include <string>
 #include <thread>
 #include <unordered_set>
+#include <unistd.h>
 #include <utility>
 #include <vector>
 
@@ -59,6 +67,16 @@ namespace
         }
         return h;
     }
+
+    // code hash of `test_code`, in place of keccak256
+    evmc::bytes32 test_code_hash(std::span<uint8_t const> const code)
+    {
+        uint64_t index = 0;
+        for (uint64_t i = 0; i < 8; ++i) {
+            index = index << 8 | code[3 + i];
+        }
+        return test_hash(index);
+    }
 }
 
 TEST(async_compile_test, stress)
@@ -151,3 +169,89 @@ TEST(async_compile_test, disable)
         ASSERT_TRUE(entry == nullptr);
     }
 }
+
+TEST(async_compile_test, warm_up_from_manifest)
+{
+    using traits = EvmTraits<EVMC_CANCUN>;
+    constexpr uint64_t N = 16;
+
+    auto const dir = std::filesystem::temp_directory_path() /
+                     ("code_manifest_test_" + std::to_string(getpid()));
+    std::filesystem::remove_all(dir);
+    {
+        Compiler compiler{true};
+        compiler.set_code_manifest(
+            std::make_unique<CodeManifest>(dir, test_code_hash));
+        for (uint64_t i = 0; i < N; ++i) {
+            compiler.cached_compile<traits>(
+                test_hash(i), make_shared_intercode(test_code(i)));
+        }
+    }
+    // a file that does not match its code hash is not loaded
+    {
+        CodeManifest const manifest{dir, test_code_hash};
+        ASSERT_EQ(manifest.list(traits::id()).size(), N);
+        ASSERT_TRUE(manifest.list(EvmTraits<EVMC_PRAGUE>::id()).empty());
+        auto const code = test_code(N + 1);
+        auto const traits_dir = std::format(
+            "v{}-{}", CodeManifest::COMPILER_VERSION, traits::id());
+        std::ofstream out{
+            dir / traits_dir / evmc::hex(test_hash(N)), std::ios::binary};
+        out.write(
+            reinterpret_cast<char const *>(code.data()),
+            static_cast<std::streamsize>(code.size()));
+    }
+
+    Compiler compiler{true};
+    compiler.set_code_manifest(
+        std::make_unique<CodeManifest>(dir, test_code_hash));
+    compiler.warm_up<traits>();
+    compiler.warm_up<traits>();
+    for (uint64_t i = 0; i < N; ++i) {
+        auto vcode = compiler.find_varcode(test_hash(i));
+        for (unsigned n = 0; !vcode.has_value() && n < 10'000; ++n) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            vcode = compiler.find_varcode(test_hash(i));
+        }
+        ASSERT_TRUE(vcode.has_value());
+        auto const entry = (*vcode)->nativecode()->entrypoint();
+        ASSERT_TRUE(entry != nullptr);
+
+        auto ctx = runtime::Context::empty();
+        ctx.gas_remaining = 100;
+        entry(&ctx, nullptr);
+        ASSERT_EQ(ctx.result.status, runtime::StatusCode::Success);
+        ASSERT_EQ(uint256_t::load_le(ctx.result.offset), i);
+    }
+    EXPECT_FALSE(compiler.find_varcode(test_hash(N)).has_value());
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST(async_compile_test, code_manifest_cap)
+{
+    using traits = EvmTraits<EVMC_CANCUN>;
+    constexpr uint64_t N = 4;
+
+    auto const dir = std::filesystem::temp_directory_path() /
+                     ("code_manifest_cap_test_" + std::to_string(getpid()));
+    std::filesystem::remove_all(dir);
+    CodeManifest manifest{dir, test_code_hash, N};
+    for (uint64_t i = 0; i < 2 * N; ++i) {
+        manifest.record(traits::id(), test_hash(i), test_code(i));
+    }
+    // recompiled, it is the most recent entry again
+    manifest.record(traits::id(), test_hash(N), test_code(N));
+
+    auto const code_hashes = manifest.list(traits::id());
+    ASSERT_EQ(code_hashes.size(), N);
+    EXPECT_EQ(code_hashes[0], test_hash(N));
+    EXPECT_EQ(code_hashes[1], test_hash(2 * N - 1));
+    EXPECT_EQ(code_hashes[2], test_hash(2 * N - 2));
+    EXPECT_EQ(code_hashes[3], test_hash(2 * N - 3));
+    EXPECT_EQ(manifest.read(traits::id(), test_hash(N)), test_code(N));
+    // the oldest entries were removed
+    EXPECT_FALSE(manifest.read(traits::id(), test_hash(0)).has_value());
+
+    std::filesystem::remove_all(dir);
+}